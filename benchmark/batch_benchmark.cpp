@@ -0,0 +1,180 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cctz/time_zone.h>
+
+#include "pendulum/batch.h"
+#include "pendulum/format.h"
+#include "pendulum/helpers.h"
+
+namespace pendulum {
+
+// A day of log timestamps, a few seconds apart
+static std::vector<time_t> sorted_timestamps() {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> step(0, 3);
+    std::vector<time_t> timestamps;
+
+    for (time_t t = 1604188800; timestamps.size() < 65536; t += step(engine)) {
+        timestamps.push_back(t);
+    }
+
+    return timestamps;
+}
+
+static void BM_Batch_CctzPerRow(benchmark::State& state) {
+    const auto& timestamps = sorted_timestamps();
+    const auto& tz = internal::timezone("America/New_York");
+
+    for (auto _ : state) {
+        for (const auto t : timestamps) {
+            benchmark::DoNotOptimize(
+                    cctz::convert(std::chrono::system_clock::from_time_t(t), tz));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * timestamps.size());
+}
+
+BENCHMARK(BM_Batch_CctzPerRow);
+
+static void BM_Batch_FromTimestampPerRow(benchmark::State& state) {
+    const auto& timestamps = sorted_timestamps();
+
+    for (auto _ : state) {
+        for (const auto t : timestamps) {
+            benchmark::DoNotOptimize(from_timestamp(t, "America/New_York"));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * timestamps.size());
+}
+
+BENCHMARK(BM_Batch_FromTimestampPerRow);
+
+static void BM_Batch_FromTimestamps(benchmark::State& state) {
+    const auto& timestamps = sorted_timestamps();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_timestamps(timestamps, "America/New_York"));
+    }
+
+    state.SetItemsProcessed(state.iterations() * timestamps.size());
+}
+
+BENCHMARK(BM_Batch_FromTimestamps);
+
+static void BM_Batch_CivilColumns(benchmark::State& state) {
+    const auto& timestamps = sorted_timestamps();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(civil_columns(timestamps, "America/New_York"));
+    }
+
+    state.SetItemsProcessed(state.iterations() * timestamps.size());
+}
+
+BENCHMARK(BM_Batch_CivilColumns);
+
+static void BM_Batch_CivilColumnsUnsorted(benchmark::State& state) {
+    auto timestamps = sorted_timestamps();
+    std::shuffle(timestamps.begin(), timestamps.end(), std::mt19937(42));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(civil_columns(timestamps, "America/New_York"));
+    }
+
+    state.SetItemsProcessed(state.iterations() * timestamps.size());
+}
+
+BENCHMARK(BM_Batch_CivilColumnsUnsorted);
+
+// ISO 8601 and a log pattern
+static const char* const kFormatPatterns[] = {"%Y-%m-%dT%H:%M:%S%Ez", "[%d/%m/%Y:%T %z]"};
+
+static void BM_Batch_FormatPerRow(benchmark::State& state) {
+    const auto& timestamps = sorted_timestamps();
+    const Format format(kFormatPatterns[state.range(0)]);
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        for (const auto t : timestamps) {
+            const auto formatted = from_timestamp(t, "America/New_York").format(format);
+            bytes += formatted.size();
+            benchmark::DoNotOptimize(formatted);
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+BENCHMARK(BM_Batch_FormatPerRow)->Arg(0)->Arg(1);
+
+static void BM_Batch_FormatToPerRow(benchmark::State& state) {
+    const auto& timestamps = sorted_timestamps();
+    const Format format(kFormatPatterns[state.range(0)]);
+    std::string buffer(timestamps.size() * format.max_size(), '\0');
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        std::size_t end = 0;
+
+        for (const auto t : timestamps) {
+            end += from_timestamp(t, "America/New_York")
+                           .format_to(&buffer[end], buffer.size() - end, format);
+        }
+
+        bytes += end;
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+BENCHMARK(BM_Batch_FormatToPerRow)->Arg(0)->Arg(1);
+
+static void BM_Batch_FormatMany(benchmark::State& state) {
+    const auto& timestamps = sorted_timestamps();
+    const Format format(kFormatPatterns[state.range(0)]);
+    StringColumn column;
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        format_many(timestamps, format, &column, "America/New_York");
+        bytes += column.data.size();
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+BENCHMARK(BM_Batch_FormatMany)->Arg(0)->Arg(1);
+
+}  // namespace pendulum
@@ -0,0 +1,96 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include "pendulum/date.h"
+#include "pendulum/datetime.h"
+
+namespace pendulum {
+
+static void BM_Date_WeekOfYear(benchmark::State& state) {
+    Date date(2020, 4, 17);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date);
+        benchmark::DoNotOptimize(date.week_of_year());
+    }
+}
+
+BENCHMARK(BM_Date_WeekOfYear);
+
+static void BM_Date_WeekOfMonth(benchmark::State& state) {
+    Date date(2020, 4, 17);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date);
+        benchmark::DoNotOptimize(date.week_of_month());
+    }
+}
+
+BENCHMARK(BM_Date_WeekOfMonth);
+
+static void BM_Date_AddMonths(benchmark::State& state) {
+    Date date(2020, 1, 31);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date);
+        benchmark::DoNotOptimize(date.add_months(13));
+    }
+}
+
+BENCHMARK(BM_Date_AddMonths);
+
+static void BM_DateTime_DayOfWeek(benchmark::State& state) {
+    DateTime dt(2020, 4, 3, 15, 30, 10, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt);
+        benchmark::DoNotOptimize(dt.day_of_week());
+    }
+}
+
+BENCHMARK(BM_DateTime_DayOfWeek);
+
+static void BM_DateTime_DayOfYear(benchmark::State& state) {
+    DateTime dt(2020, 4, 3, 15, 30, 10, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt);
+        benchmark::DoNotOptimize(dt.day_of_year());
+    }
+}
+
+BENCHMARK(BM_DateTime_DayOfYear);
+
+static void BM_DateTime_AddMonths(benchmark::State& state) {
+    DateTime dt(2020, 1, 31, 15, 30, 10, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt);
+        benchmark::DoNotOptimize(dt.add_months(1));
+    }
+}
+
+BENCHMARK(BM_DateTime_AddMonths);
+
+}  // namespace pendulum
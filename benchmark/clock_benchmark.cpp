@@ -0,0 +1,83 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+#include "pendulum/helpers.h"
+
+namespace pendulum {
+
+static void BM_Now(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(now("America/New_York"));
+    }
+}
+
+BENCHMARK(BM_Now);
+
+static void BM_FastNow(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fast_now("America/New_York"));
+    }
+}
+
+BENCHMARK(BM_FastNow);
+
+static void BM_Today(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(today("America/New_York"));
+    }
+}
+
+BENCHMARK(BM_Today);
+
+static void BM_Now_SystemClock(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(now<SystemClock>("America/New_York"));
+    }
+}
+
+BENCHMARK(BM_Now_SystemClock);
+
+static void BM_Now_TickClock(benchmark::State& state) {
+    TickClock clock(DateTime(2020, 1, 1), std::chrono::microseconds(1));
+    ScopedClock scoped(clock);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(now("America/New_York"));
+    }
+}
+
+BENCHMARK(BM_Now_TickClock)->ThreadRange(1, 4);
+
+static void BM_FromTimePoint(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            from_time_point(std::chrono::system_clock::now(), "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_FromTimePoint);
+
+}  // namespace pendulum
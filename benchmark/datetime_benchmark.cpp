@@ -0,0 +1,185 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <random>
+#include <vector>
+
+#include "pendulum/datetime.h"
+#include "pendulum/helpers.h"
+
+namespace pendulum {
+
+static std::vector<DateTime> shuffled_datetimes(std::size_t n) {
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<time_t> dist(0, 2000000000);
+    std::vector<DateTime> dts;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        dts.push_back(from_timestamp(dist(engine), "America/New_York"));
+    }
+
+    return dts;
+}
+
+static void BM_DateTime_Construct(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(DateTime(2020, 4, 3, 15, 30, 10, "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_DateTime_Construct);
+
+static void BM_DateTime_DefaultConstruct(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(DateTime());
+    }
+}
+
+BENCHMARK(BM_DateTime_DefaultConstruct);
+
+static void BM_DateTime_Fields(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.year());
+        benchmark::DoNotOptimize(dt.hour());
+        benchmark::DoNotOptimize(dt.offset());
+    }
+}
+
+BENCHMARK(BM_DateTime_Fields);
+
+static void BM_DateTime_FromTimePoint(benchmark::State& state) {
+    const auto tp = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_time_point(tp, "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_DateTime_FromTimePoint);
+
+static void BM_DateTime_ToTimePoint(benchmark::State& state) {
+    const auto& dt = from_time_point(std::chrono::system_clock::now(), "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.time_point<std::chrono::nanoseconds>());
+    }
+}
+
+BENCHMARK(BM_DateTime_ToTimePoint);
+
+static void BM_DateTime_Copy(benchmark::State& state) {
+    const auto& dts = shuffled_datetimes(state.range(0));
+
+    for (auto _ : state) {
+        std::vector<DateTime> copy(dts);
+        benchmark::DoNotOptimize(copy.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(DateTime));
+}
+
+BENCHMARK(BM_DateTime_Copy)->Arg(1 << 20);
+
+static void BM_DateTime_Sort(benchmark::State& state) {
+    const auto& dts = shuffled_datetimes(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = dts;
+        state.ResumeTiming();
+
+        std::sort(copy.begin(), copy.end());
+        benchmark::DoNotOptimize(copy.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_DateTime_Sort)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_DateTime_Dedup(benchmark::State& state) {
+    // Every instant four times, in different zones
+    std::vector<DateTime> dts;
+    for (const auto& dt : shuffled_datetimes(state.range(0) / 4)) {
+        for (const auto* tz : {"UTC", "Asia/Tokyo", "Europe/Paris", "America/New_York"}) {
+            dts.push_back(dt.in_timezone(tz));
+        }
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = dts;
+        state.ResumeTiming();
+
+        std::sort(copy.begin(), copy.end());
+        copy.erase(std::unique(copy.begin(), copy.end()), copy.end());
+        benchmark::DoNotOptimize(copy.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_DateTime_Dedup)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_DateTime_Compare(benchmark::State& state) {
+    const DateTime a(2020, 4, 3, 15, 0, 0, "Asia/Tokyo");
+    const DateTime b(2020, 4, 3, 15, 0, 0, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a < b);
+        benchmark::DoNotOptimize(a == b);
+    }
+}
+
+BENCHMARK(BM_DateTime_Compare);
+
+static void BM_DateTime_StartOf(benchmark::State& state) {
+    DateTime dt(2020, 4, 3, 15, 30, 10, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt);
+        benchmark::DoNotOptimize(dt.start_of("minute"));
+    }
+}
+
+BENCHMARK(BM_DateTime_StartOf);
+
+static void BM_DateTime_StartOfUnit(benchmark::State& state) {
+    DateTime dt(2020, 4, 3, 15, 30, 10, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt);
+        benchmark::DoNotOptimize(dt.start_of<Unit::kMinute>());
+    }
+}
+
+BENCHMARK(BM_DateTime_StartOfUnit);
+
+}  // namespace pendulum
@@ -0,0 +1,112 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include "pendulum/datetime.h"
+#include "pendulum/fixed_offset_datetime.h"
+
+namespace pendulum {
+
+static void BM_FixedOffsetDateTime_DateTimeTimestamp(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.timestamp());
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_DateTimeTimestamp);
+
+static void BM_FixedOffsetDateTime_UtcTimestamp(benchmark::State& state) {
+    const UtcDateTime dt(2020, 4, 3, 15, 30, 10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.timestamp());
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_UtcTimestamp);
+
+static void BM_FixedOffsetDateTime_DateTimeOffset(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.offset());
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_DateTimeOffset);
+
+static void BM_FixedOffsetDateTime_UtcOffset(benchmark::State& state) {
+    const UtcDateTime dt(2020, 4, 3, 15, 30, 10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.offset());
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_UtcOffset);
+
+static void BM_FixedOffsetDateTime_DateTimeCompare(benchmark::State& state) {
+    const DateTime a(2020, 4, 3, 15, 30, 10);
+    const DateTime b(2020, 4, 3, 15, 30, 11);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a < b);
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_DateTimeCompare);
+
+static void BM_FixedOffsetDateTime_UtcCompare(benchmark::State& state) {
+    const UtcDateTime a(2020, 4, 3, 15, 30, 10);
+    const UtcDateTime b(2020, 4, 3, 15, 30, 11);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a < b);
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_UtcCompare);
+
+static void BM_FixedOffsetDateTime_DateTimeFormat(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.to_iso8601_string());
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_DateTimeFormat);
+
+static void BM_FixedOffsetDateTime_UtcFormat(benchmark::State& state) {
+    const UtcDateTime dt(2020, 4, 3, 15, 30, 10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.to_iso8601_string());
+    }
+}
+
+BENCHMARK(BM_FixedOffsetDateTime_UtcFormat);
+
+}  // namespace pendulum
@@ -0,0 +1,201 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "pendulum/datetime.h"
+#include "pendulum/format.h"
+#include "pendulum/parser.h"
+
+namespace pendulum {
+
+// Timestamp of a common log format line
+static const char* kLogPattern = "[%d/%m/%Y:%H:%M:%S %z]";
+
+static void BM_Format_Pattern(benchmark::State& state) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "America/New_York");
+    const std::string pattern = kLogPattern;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.format(pattern));
+    }
+}
+
+BENCHMARK(BM_Format_Pattern);
+
+static void BM_Format_Compiled(benchmark::State& state) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "America/New_York");
+    const Format format(kLogPattern);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.format(format));
+    }
+}
+
+BENCHMARK(BM_Format_Compiled);
+
+static void BM_Format_Iso8601(benchmark::State& state) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "America/New_York").add_microseconds(250);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.to_iso8601_string());
+    }
+}
+
+BENCHMARK(BM_Format_Iso8601);
+
+static void BM_Format_Date(benchmark::State& state) {
+    const Date date(2020, 4, 3);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date.to_date_string());
+    }
+}
+
+BENCHMARK(BM_Format_Date);
+
+static void BM_Format_Cctz(benchmark::State& state) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "America/New_York");
+    const Format format("%a, %d %b %Y %H:%M:%S %Z");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.format(format));
+    }
+}
+
+BENCHMARK(BM_Format_Cctz);
+
+static void BM_FormatTo_Iso8601(benchmark::State& state) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "America/New_York").add_microseconds(250);
+    char buffer[max_format_size("%Y-%m-%dT%H:%M:%E*S%Ez")];
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.format_to(buffer, sizeof(buffer)));
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_FormatTo_Iso8601);
+
+static void BM_FormatTo_Date(benchmark::State& state) {
+    const Date date(2020, 4, 3);
+    char buffer[max_format_size("%Y-%m-%d")];
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date.format_to(buffer, sizeof(buffer)));
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_FormatTo_Date);
+
+static void BM_FormatTo_Log(benchmark::State& state) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "America/New_York");
+    const Format format(kLogPattern);
+    char buffer[64];
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.format_to(buffer, sizeof(buffer), format));
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_FormatTo_Log);
+
+// Timestamps of consecutive log lines, a millisecond apart
+static std::vector<DateTime> consecutive_datetimes() {
+    std::vector<DateTime> dts = {DateTime(2020, 4, 3, 15, 30, 10, "America/New_York")};
+
+    while (dts.size() < 4096) {
+        dts.push_back(dts.back().add_microseconds(1000));
+    }
+
+    return dts;
+}
+
+static void BM_FormatTo_Consecutive(benchmark::State& state) {
+    const auto dts = consecutive_datetimes();
+    const Format format(state.range(0) == 0 ? kLogPattern : "%Y-%m-%dT%H:%M:%E*S%Ez");
+    char buffer[64];
+    std::size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dts[i++ % dts.size()].format_to(buffer, sizeof(buffer), format));
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_FormatTo_Consecutive)->Arg(0)->Arg(1);
+
+static void BM_FormatToCached_Consecutive(benchmark::State& state) {
+    const auto dts = consecutive_datetimes();
+    const Format format(state.range(0) == 0 ? kLogPattern : "%Y-%m-%dT%H:%M:%E*S%Ez");
+    char buffer[64];
+    std::size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                dts[i++ % dts.size()].format_to_cached(buffer, sizeof(buffer), format));
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_FormatToCached_Consecutive)->Arg(0)->Arg(1);
+
+static void BM_Format_Stream(benchmark::State& state) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "America/New_York").add_microseconds(250);
+    std::ostringstream out;
+
+    for (auto _ : state) {
+        out.seekp(0);
+        out << dt;
+    }
+}
+
+BENCHMARK(BM_Format_Stream);
+
+static void BM_FromFormat_Compiled(benchmark::State& state) {
+    const std::string input = "[03/04/2020:15:30:10 -0400]";
+    const Format format(kLogPattern);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_format(input, format, "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_FromFormat_Compiled);
+
+static void BM_FromFormat_Pattern(benchmark::State& state) {
+    const std::string input = "[03/04/2020:15:30:10 -0400]";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_format(input, kLogPattern, "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_FromFormat_Pattern);
+
+}  // namespace pendulum
@@ -0,0 +1,96 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <ctime>
+#include <functional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "pendulum/date.h"
+#include "pendulum/datetime.h"
+#include "pendulum/helpers.h"
+#include "pendulum/period.h"
+
+namespace pendulum {
+
+static void BM_Hash_DateTime(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10, "America/New_York");
+    const std::hash<DateTime> hash;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash(dt));
+    }
+}
+
+BENCHMARK(BM_Hash_DateTime);
+
+static void BM_Hash_Date(benchmark::State& state) {
+    const Date date(2020, 4, 3);
+    const std::hash<Date> hash;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash(date));
+    }
+}
+
+BENCHMARK(BM_Hash_Date);
+
+static void BM_Hash_Period(benchmark::State& state) {
+    const Period period(DateTime(2020, 1, 1, "Europe/Paris"), DateTime(2021, 1, 1, "Asia/Tokyo"));
+    const std::hash<Period> hash;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash(period));
+    }
+}
+
+BENCHMARK(BM_Hash_Period);
+
+// Group-by over events which repeat every instant a few times
+static void BM_Hash_UnorderedMap(benchmark::State& state) {
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<time_t> dist(1600000000, 1600000000 + state.range(0) / 4);
+    std::vector<DateTime> dts;
+
+    for (int i = 0; i < state.range(0); ++i) {
+        dts.push_back(from_timestamp(dist(engine), "America/New_York"));
+    }
+
+    for (auto _ : state) {
+        std::unordered_map<DateTime, int> counts;
+
+        for (const auto& dt : dts) {
+            ++counts[dt];
+        }
+
+        benchmark::DoNotOptimize(counts.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Hash_UnorderedMap)->Arg(1 << 16);
+
+}  // namespace pendulum
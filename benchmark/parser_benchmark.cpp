@@ -0,0 +1,220 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "pendulum/exceptions.h"
+#include "pendulum/helpers.h"
+#include "pendulum/parser.h"
+
+namespace pendulum {
+
+static void BM_Parse(benchmark::State& state) {
+    const std::string input = "2006-01-02T15:04:05Z";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse(input));
+    }
+}
+
+BENCHMARK(BM_Parse);
+
+static void BM_TryParse(benchmark::State& state) {
+    const std::string input = "2006-01-02T15:04:05Z";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(try_parse(input));
+    }
+}
+
+BENCHMARK(BM_TryParse);
+
+static void BM_Parse_Date(benchmark::State& state) {
+    const std::string input = "2006-01-02";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse(input, "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_Parse_Date);
+
+static void BM_Parse_Offset(benchmark::State& state) {
+    const std::string input = "2006-01-02T15:04:05.123456-07:00";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse(input, "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_Parse_Offset);
+
+static void BM_FromFormat(benchmark::State& state) {
+    const std::string input = "2006-01-02 15:04:05";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_format(input, "%Y-%m-%d %H:%M:%S", "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_FromFormat);
+
+static void BM_FromFormat_Ymd(benchmark::State& state) {
+    const std::string input = "20060102";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_format(input, "%Y%m%d", "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_FromFormat_Ymd);
+
+// A column of log timestamps, a few seconds apart
+static std::vector<std::string> timestamp_column() {
+    std::vector<std::string> rows;
+
+    for (auto dt = DateTime(2020, 11, 1); rows.size() < 65536; dt = dt.add_seconds(3)) {
+        rows.push_back(dt.format("%Y-%m-%dT%H:%M:%E3S%Ez"));
+    }
+
+    return rows;
+}
+
+static void BM_Parse_PerRow(benchmark::State& state) {
+    const auto& rows = timestamp_column();
+
+    for (auto _ : state) {
+        for (const auto& row : rows) {
+            benchmark::DoNotOptimize(try_parse(row, "America/New_York"));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+BENCHMARK(BM_Parse_PerRow);
+
+static void BM_ParseMany(benchmark::State& state) {
+    const auto& column = timestamp_column();
+    const std::vector<internal::string_view> rows(column.begin(), column.end());
+    std::vector<DateTime> dts;
+    ValidityBitmap valid;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_many(rows, &dts, &valid, "America/New_York"));
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+BENCHMARK(BM_ParseMany);
+
+static void BM_ParseMany_TimePoints(benchmark::State& state) {
+    const auto& column = timestamp_column();
+    const std::vector<internal::string_view> rows(column.begin(), column.end());
+    std::vector<std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>> tps;
+    ValidityBitmap valid;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_many(rows, &tps, &valid, "America/New_York"));
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+BENCHMARK(BM_ParseMany_TimePoints);
+
+static void BM_Parse_Invalid(benchmark::State& state) {
+    const std::string input = "2006/01/02";
+
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(parse(input));
+        } catch (const UnsupportedFormat&) {
+            benchmark::ClobberMemory();
+        }
+    }
+}
+
+BENCHMARK(BM_Parse_Invalid);
+
+static void BM_TryParse_Invalid(benchmark::State& state) {
+    const std::string input = "2006/01/02";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(try_parse(input));
+    }
+}
+
+BENCHMARK(BM_TryParse_Invalid);
+
+static void BM_DateTime_Invalid(benchmark::State& state) {
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(DateTime(2020, 2, 30, 12, 0, 0, "America/New_York"));
+        } catch (const InvalidDateTime&) {
+            benchmark::ClobberMemory();
+        }
+    }
+}
+
+BENCHMARK(BM_DateTime_Invalid);
+
+static void BM_DateTime_TryCreate_Invalid(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(DateTime::create(2020, 2, 30, 12, 0, 0, "America/New_York"));
+    }
+}
+
+BENCHMARK(BM_DateTime_TryCreate_Invalid);
+
+static void BM_DateTime_StartOf_InvalidUnit(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10);
+    const std::string unit = "century";
+
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(dt.start_of(unit));
+        } catch (const InvalidUnit&) {
+            benchmark::ClobberMemory();
+        }
+    }
+}
+
+BENCHMARK(BM_DateTime_StartOf_InvalidUnit);
+
+static void BM_DateTime_TryStartOf_InvalidUnit(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10);
+    const std::string unit = "century";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.try_start_of(unit));
+    }
+}
+
+BENCHMARK(BM_DateTime_TryStartOf_InvalidUnit);
+
+}  // namespace pendulum
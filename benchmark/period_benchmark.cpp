@@ -0,0 +1,75 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include "pendulum/datetime.h"
+#include "pendulum/period.h"
+
+namespace pendulum {
+
+static void BM_Period_Contains(benchmark::State& state) {
+    const Period period(DateTime(2020, 1, 1, "Europe/Paris"), DateTime(2021, 1, 1, "Asia/Tokyo"));
+    const DateTime dt(2020, 6, 1, 12, 0, 0, "America/New_York");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(period.contains(dt));
+    }
+}
+
+BENCHMARK(BM_Period_Contains);
+
+static void BM_Period_InSeconds(benchmark::State& state) {
+    const Period period(DateTime(2020, 1, 1, "Europe/Paris"), DateTime(2021, 1, 1, "Asia/Tokyo"));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(period.in_seconds());
+    }
+}
+
+BENCHMARK(BM_Period_InSeconds);
+
+static void BM_Period_Range(benchmark::State& state) {
+    const Period period(DateTime(2020, 1, 1), DateTime(2020, 1, 2));
+
+    for (auto _ : state) {
+        for (const auto& dt : period.range("minutes", 15)) {
+            benchmark::DoNotOptimize(dt);
+        }
+    }
+}
+
+BENCHMARK(BM_Period_Range);
+
+static void BM_Period_RangeUnit(benchmark::State& state) {
+    const Period period(DateTime(2020, 1, 1), DateTime(2020, 1, 2));
+
+    for (auto _ : state) {
+        for (const auto& dt : period.range<Unit::kMinute>(15)) {
+            benchmark::DoNotOptimize(dt);
+        }
+    }
+}
+
+BENCHMARK(BM_Period_RangeUnit);
+
+}  // namespace pendulum
@@ -0,0 +1,75 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include "pendulum/parser.h"
+#include "pendulum/simd.h"
+
+namespace pendulum {
+
+static void BM_DecodeUtc(benchmark::State& state) {
+    const auto level = static_cast<internal::SimdLevel>(state.range(0));
+    const std::string input = "2006-01-02T15:04:05.123456789Z";
+    std::int64_t instant = 0;
+    std::int32_t nanos = 0;
+
+    if (level > internal::simd_level()) {
+        state.SkipWithError("unsupported");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(internal::decode_utc_timestamp(input, level, &instant, &nanos));
+        benchmark::DoNotOptimize(instant);
+    }
+}
+
+BENCHMARK(BM_DecodeUtc)
+        ->Arg(static_cast<int>(internal::SimdLevel::kScalar))
+        ->Arg(static_cast<int>(internal::SimdLevel::kSse41))
+        ->Arg(static_cast<int>(internal::SimdLevel::kAvx2));
+
+static void BM_FromFormat_Utc(benchmark::State& state) {
+    const std::string input = "2006-01-02T15:04:05.123456789Z";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_format(input, "%Y-%m-%dT%H:%M:%E*SZ"));
+    }
+}
+
+BENCHMARK(BM_FromFormat_Utc);
+
+static void BM_Parse_Utc(benchmark::State& state) {
+    const std::string input = "2006-01-02T15:04:05.123456789Z";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse(input));
+    }
+}
+
+BENCHMARK(BM_Parse_Utc);
+
+}  // namespace pendulum
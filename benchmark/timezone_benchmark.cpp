@@ -0,0 +1,139 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+
+#include <cctz/time_zone.h>
+
+#include "pendulum/datetime.h"
+#include "pendulum/timezone.h"
+
+namespace pendulum {
+
+static void BM_Timezone_LoadTimeZone(benchmark::State& state) {
+    for (auto _ : state) {
+        cctz::time_zone tz;
+        cctz::load_time_zone("America/Sao_Paulo", &tz);
+        benchmark::DoNotOptimize(tz);
+    }
+}
+
+BENCHMARK(BM_Timezone_LoadTimeZone)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_Timezone_Registry(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(internal::timezone("America/Sao_Paulo"));
+    }
+}
+
+BENCHMARK(BM_Timezone_Registry)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_Timezone_RegistryById(benchmark::State& state) {
+    const auto id = internal::zone_id("America/Sao_Paulo");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(internal::timezone(id));
+    }
+}
+
+BENCHMARK(BM_Timezone_RegistryById)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_Timezone_DateTime(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(DateTime(2020, 4, 3, 15, 30, 10, "America/Sao_Paulo"));
+    }
+}
+
+BENCHMARK(BM_Timezone_DateTime)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_Timezone_CctzLocalTimeZone(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cctz::local_time_zone());
+    }
+}
+
+BENCHMARK(BM_Timezone_CctzLocalTimeZone);
+
+static void BM_Timezone_LocalZone(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(internal::zone_id("local"));
+    }
+}
+
+BENCHMARK(BM_Timezone_LocalZone)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_Timezone_UtcZone(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(internal::zone_id("UTC"));
+    }
+}
+
+BENCHMARK(BM_Timezone_UtcZone);
+
+static void BM_Timezone_IsLocal(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10, "local");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.is_local());
+    }
+}
+
+BENCHMARK(BM_Timezone_IsLocal);
+
+static void BM_Timezone_CctzFixedOffset(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cctz::fixed_time_zone(std::chrono::seconds(19800)));
+    }
+}
+
+BENCHMARK(BM_Timezone_CctzFixedOffset);
+
+static void BM_Timezone_PooledFixedOffset(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(internal::zone_id(std::chrono::seconds(19800)));
+    }
+}
+
+BENCHMARK(BM_Timezone_PooledFixedOffset);
+
+static void BM_Timezone_CachedFixedOffset(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(internal::zone_id(std::chrono::seconds(19801)));
+    }
+}
+
+BENCHMARK(BM_Timezone_CachedFixedOffset);
+
+static void BM_Timezone_InOffsetHours(benchmark::State& state) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dt.in_offset_hours(5, 30));
+    }
+}
+
+BENCHMARK(BM_Timezone_InOffsetHours);
+
+}  // namespace pendulum
@@ -0,0 +1,124 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include "pendulum/datetime.h"
+#include "pendulum/timezone.h"
+#include "pendulum/transitions.h"
+
+namespace pendulum {
+
+namespace {
+
+// An instant every ~5 hours from 1990 to 2030
+std::vector<std::int64_t> instants() {
+    std::vector<std::int64_t> v;
+
+    for (std::int64_t t = 631152000; t < 1893456000; t += 17989) {
+        v.push_back(t);
+    }
+
+    return v;
+}
+
+}  // namespace
+
+static void BM_Transitions_CctzOffset(benchmark::State& state) {
+    const auto& tz = internal::timezone("America/New_York");
+    const auto& v = instants();
+
+    for (auto _ : state) {
+        for (const auto t : v) {
+            const cctz::time_point<cctz::seconds> tp(cctz::seconds{t});
+            benchmark::DoNotOptimize(tz.lookup(tp).offset);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+
+BENCHMARK(BM_Transitions_CctzOffset);
+
+static void BM_Transitions_TableOffset(benchmark::State& state) {
+    const auto& table = internal::zone(internal::zone_id("America/New_York")).table;
+    const auto& v = instants();
+
+    for (auto _ : state) {
+        for (const auto t : v) {
+            benchmark::DoNotOptimize(table.lookup(t).offset);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+
+BENCHMARK(BM_Transitions_TableOffset);
+
+static void BM_Transitions_CctzToInstant(benchmark::State& state) {
+    const auto& tz = internal::timezone("America/New_York");
+    const auto& v = instants();
+
+    for (auto _ : state) {
+        for (const auto t : v) {
+            benchmark::DoNotOptimize(cctz::convert(internal::to_civil(t), tz));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+
+BENCHMARK(BM_Transitions_CctzToInstant);
+
+static void BM_Transitions_TableToInstant(benchmark::State& state) {
+    const auto& table = internal::zone(internal::zone_id("America/New_York")).table;
+    const auto& v = instants();
+
+    for (auto _ : state) {
+        for (const auto t : v) {
+            benchmark::DoNotOptimize(table.to_instant(t));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+
+BENCHMARK(BM_Transitions_TableToInstant);
+
+static void BM_Transitions_DateTimeCompare(benchmark::State& state) {
+    const DateTime a(2020, 4, 3, 15, 30, 10, "America/New_York");
+    const DateTime b(2020, 4, 3, 21, 30, 10, "Europe/Paris");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a < b);
+    }
+}
+
+BENCHMARK(BM_Transitions_DateTimeCompare);
+
+}  // namespace pendulum
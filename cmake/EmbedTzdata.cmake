@@ -0,0 +1,99 @@
+#
+# Generates a C++ source which embeds compiled tzdata (TZif files) into the binary and installs
+# it as cctz's zoneinfo source.
+#
+#   cmake -DTZDATA_DIR=<dir> [-DTZDATA_ZONES=<zone>,<zone>,...] -DOUTPUT=<file> -P EmbedTzdata.cmake
+#
+# TZDATA_DIR is a zoneinfo directory, either the host's or one compiled by zic from a tzdata
+# release. All zones in it are embedded unless TZDATA_ZONES lists some of them.
+#
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT TZDATA_DIR OR NOT OUTPUT)
+    message(FATAL_ERROR "TZDATA_DIR and OUTPUT are required")
+endif()
+
+if(TZDATA_ZONES)
+    string(REPLACE "," ";" zones "${TZDATA_ZONES}")
+else()
+    file(GLOB_RECURSE zones RELATIVE ${TZDATA_DIR} ${TZDATA_DIR}/*)
+    list(FILTER zones EXCLUDE REGEX "^(posix|right)/|^localtime$|^posixrules$")
+endif()
+
+list(SORT zones)
+
+set(version "")
+
+if(EXISTS ${TZDATA_DIR}/+VERSION)
+    file(STRINGS ${TZDATA_DIR}/+VERSION version LIMIT_COUNT 1)
+elseif(EXISTS ${TZDATA_DIR}/tzdata.zi)
+    file(STRINGS ${TZDATA_DIR}/tzdata.zi version LIMIT_COUNT 1 REGEX "^# version ")
+    string(REGEX REPLACE "^# version " "" version "${version}")
+endif()
+
+set(arrays "")
+set(entries "")
+set(count 0)
+
+foreach(zone ${zones})
+    set(path ${TZDATA_DIR}/${zone})
+
+    if(NOT EXISTS ${path} OR IS_DIRECTORY ${path})
+        if(TZDATA_ZONES)
+            message(FATAL_ERROR "No zoneinfo for ${zone} in ${TZDATA_DIR}")
+        endif()
+        continue()
+    endif()
+
+    file(READ ${path} magic LIMIT 4 HEX)
+
+    if(NOT magic STREQUAL "545a6966")
+        continue()
+    endif()
+
+    # Links share the data of the zone they point to
+    file(SHA1 ${path} digest)
+
+    if(NOT DEFINED data_${digest})
+        file(READ ${path} hex HEX)
+        string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${hex}")
+        string(REGEX REPLACE "(0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,)"
+               "\\1\n        " bytes "${bytes}")
+
+        set(data_${digest} kData${count})
+        string(APPEND arrays "const unsigned char kData${count}[] = {\n        ${bytes}\n};\n\n")
+        math(EXPR count "${count} + 1")
+    endif()
+
+    set(data ${data_${digest}})
+    string(APPEND entries "        {\"${zone}\", ${data}, sizeof(${data})},\n")
+endforeach()
+
+if(count EQUAL 0)
+    message(FATAL_ERROR "No zoneinfo found in ${TZDATA_DIR}")
+endif()
+
+file(WRITE ${OUTPUT} "// Generated by cmake/EmbedTzdata.cmake from ${TZDATA_DIR}. Do not edit.
+
+#include \"pendulum/tzdata.h\"
+
+namespace pendulum {
+namespace internal {
+namespace {
+
+${arrays}const EmbeddedZone kZones[] = {
+${entries}};
+
+}  // namespace
+
+const EmbeddedTzdata& embedded_tzdata() {
+    static const EmbeddedTzdata tzdata = {kZones, sizeof(kZones) / sizeof(kZones[0]), \"${version}\"};
+    return tzdata;
+}
+
+}  // namespace internal
+}  // namespace pendulum
+
+cctz_extension::ZoneInfoSourceFactory cctz_extension::zone_info_source_factory =
+        pendulum::internal::embedded_zone_info_source;
+")
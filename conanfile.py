@@ -19,6 +19,8 @@ class PendulumConan(ConanFile):
     exports_sources = (
         "pendulum/*",
         "test/*",
+        "benchmark/*",
+        "cmake/*",
         "CMakeLists.txt",
         "version.h.in",
         "VERSION",
@@ -30,7 +32,9 @@ class PendulumConan(ConanFile):
     def requirements(self):
         self.requires("cctz/2.3")  # type: ignore[reportOptionalCall]
         self.requires("tl-optional/1.1.0")  # type: ignore[reportOptionalCall]
+        self.requires("string-view-lite/1.7.0")  # type: ignore[reportOptionalCall]
         self.requires("gtest/1.10.0", test=True)  # type: ignore[reportOptionalCall]
+        self.requires("benchmark/1.8.3", test=True)  # type: ignore[reportOptionalCall]
 
     def layout(self):
         cmake_layout(self)
@@ -0,0 +1,485 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_BATCH_H_
+#define PENDULUM_BATCH_H_
+
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "pendulum/constants.h"
+#include "pendulum/datetime.h"
+#include "pendulum/format.h"
+#include "pendulum/internal.h"
+#include "pendulum/timezone.h"
+#include "pendulum/transitions.h"
+
+namespace pendulum {
+
+// Civil fields of many instants, one array per field
+struct CivilColumns {
+    std::vector<int> year;
+    std::vector<int> month;
+    std::vector<int> day;
+    std::vector<int> hour;
+    std::vector<int> minute;
+    std::vector<int> second;
+
+    std::size_t size() const { return year.size(); }
+
+    void resize(std::size_t n) {
+        for (auto* column : {&year, &month, &day, &hour, &minute, &second}) {
+            column->resize(n);
+        }
+    }
+};
+
+// One bit per row, set for the valid rows
+class ValidityBitmap {
+   public:
+    void assign(std::size_t size) {
+        size_ = size;
+        words_.assign((size + 63) / 64, 0);
+    }
+
+    void set(std::size_t i) { words_[i / 64] |= std::uint64_t(1) << (i % 64); }
+    bool operator[](std::size_t i) const { return (words_[i / 64] >> (i % 64)) & 1; }
+
+    std::size_t size() const { return size_; }
+
+    std::size_t count() const {
+        std::size_t n = 0;
+
+        for (const auto word : words_) {
+            n += std::bitset<64>(word).count();
+        }
+
+        return n;
+    }
+
+    const std::vector<std::uint64_t>& words() const { return words_; }
+
+   private:
+    std::size_t size_ = 0;
+    std::vector<std::uint64_t> words_;
+};
+
+// Values of many rows in one buffer, as in an Arrow string column: row i is the characters
+// [offsets[i], offsets[i + 1]) of data
+struct StringColumn {
+    std::string data;
+    std::vector<std::int64_t> offsets = {0};
+
+    std::size_t size() const { return offsets.size() - 1; }
+
+    internal::string_view operator[](std::size_t i) const {
+        return internal::string_view(data.data() + offsets[i],
+                                     static_cast<std::size_t>(offsets[i + 1] - offsets[i]));
+    }
+};
+
+namespace internal {
+
+struct CivilFields {
+    int year;
+    int month;
+    int day;
+    int hour;
+    int minute;
+    int second;
+};
+
+// Converts UTC instants into civil fields of a zone, reusing the date and offset of the previous
+// instant as long as the next one stays within the same local day and transition span. Sorted
+// input therefore costs a division per row and a full conversion per day; any other input is
+// still converted correctly, only with more full conversions.
+class CivilSweep {
+   public:
+    explicit CivilSweep(const TransitionTable& table)
+            : table_(table),
+              lower_(1),
+              upper_(0),
+              day_begin_(0),
+              offset_(0),
+              year_(0),
+              month_(0),
+              day_(0) {}
+
+    CivilFields operator()(std::int64_t instant) {
+        seek(instant);
+
+        const auto seconds = instant - day_begin_;
+        const auto minutes = seconds / kSecondsPerMinute;
+
+        return CivilFields{year_,
+                           month_,
+                           day_,
+                           static_cast<int>(minutes / kMinutesPerHour),
+                           static_cast<int>(minutes % kMinutesPerHour),
+                           static_cast<int>(seconds % kSecondsPerMinute)};
+    }
+
+    // Moves to the local day and span of the instant, and returns whether they changed
+    bool seek(std::int64_t instant) {
+        if (instant >= lower_ && instant < upper_) {
+            return false;
+        }
+
+        reset(instant);
+        return true;
+    }
+
+    std::int64_t day_begin() const { return day_begin_; }
+    std::int32_t offset() const { return offset_; }
+    CivilDay date() const { return CivilDay{year_, month_, day_}; }
+
+   private:
+    void reset(std::int64_t instant) {
+        const auto span = table_.span(instant);
+        const auto local = instant + span.info.offset;
+        auto days = local / kSecondsPerDay;
+
+        if (local % kSecondsPerDay < 0) {
+            --days;
+        }
+
+        const auto cd = civil_from_days(days);
+        year_ = static_cast<int>(cd.year);
+        month_ = cd.month;
+        day_ = cd.day;
+
+        offset_ = span.info.offset;
+        day_begin_ = instant - (local - days * kSecondsPerDay);
+        lower_ = std::max(span.begin, day_begin_);
+        upper_ = std::min(span.end, day_begin_ + kSecondsPerDay);
+    }
+
+    const TransitionTable& table_;
+    std::int64_t lower_;
+    std::int64_t upper_;
+    std::int64_t day_begin_;  // UTC instant of the local midnight
+    std::int32_t offset_;
+    int year_;
+    int month_;
+    int day_;
+};
+
+// Writes hh:mm:ss of the seconds of a day. The three values sit 3 bytes apart in a word, whose
+// tens are divided out together, as v * 103 >> 10 is v / 10 below 100.
+inline char* write_clock(char* out, std::uint64_t seconds) {
+    const auto x = seconds / 3600 | (seconds / 60 % 60) << 24 | (seconds % 60) << 48;
+    const auto tens = (x * 103 >> 10) & 0x000f00000f00000f;
+    const auto text = tens | (x - tens * 10) << 8 | 0x30303a30303a3030;
+
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<char>(text >> (8 * i));
+    }
+
+    return out + 8;
+}
+
+// Appends the values of a column of instants to a StringColumn. The fields other than the time of
+// day are rendered once per local day and transition span of each zone, as the text between the
+// time fields, so that a row only copies that text and writes its time.
+class ColumnFormatter {
+   public:
+    ColumnFormatter(const Format& format, std::size_t rows, StringColumn* out)
+            : format_(format), rows_(rows), out_(out), end_(0) {
+        out_->data.clear();
+        out_->offsets.assign(1, 0);
+        out_->offsets.reserve(rows + 1);
+
+        plan();
+    }
+
+    void append(std::int64_t instant, std::int32_t nanos, ZoneId zone) {
+        auto& span = seek(instant, zone);
+        const FormatValue value{instant, nanos, span.sweep.offset(), zone};
+
+        if (format_.formats_natively()) {
+            grow(format_.max_size());
+            end_ = static_cast<std::size_t>(write(span, value, &out_->data[end_]) - &out_->data[0]);
+        } else {
+            const auto formatted = format_.format(value);
+            grow(formatted.size());
+            std::memcpy(&out_->data[end_], formatted.data(), formatted.size());
+            end_ += formatted.size();
+        }
+
+        out_->offsets.push_back(static_cast<std::int64_t>(end_));
+    }
+
+    // Drops the room left after the last row
+    void finish() { out_->data.resize(end_); }
+
+   private:
+    enum class StepKind : std::uint8_t { kText, kClock, kField };
+
+    // Fields [begin, end) of the format
+    struct Step {
+        StepKind kind;
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    struct ZoneSpan {
+        ZoneId zone;
+        CivilSweep sweep;
+        CivilDay date;
+        std::string text;
+        // Text of the k-th kText step in text
+        std::vector<std::uint32_t> bounds;
+    };
+
+    void plan() {
+        const auto& fields = format_.fields();
+
+        for (std::size_t i = 0; i < fields.size();) {
+            if (is_clock(i)) {
+                steps_.push_back(Step{StepKind::kClock, i, i + 5});
+                i += 5;
+            } else if (is_time_of_day(fields[i].op)) {
+                steps_.push_back(Step{StepKind::kField, i, i + 1});
+                ++i;
+            } else {
+                if (steps_.empty() || steps_.back().kind != StepKind::kText) {
+                    steps_.push_back(Step{StepKind::kText, i, i});
+                }
+
+                steps_.back().end = ++i;
+            }
+        }
+    }
+
+    // %H:%M:%S, as in %T
+    bool is_clock(std::size_t i) const {
+        const auto& fields = format_.fields();
+        const auto is_colon = [&](const FormatField& field) {
+            return field.op == FormatOp::kLiteral && format_.literal(field) == ":";
+        };
+
+        return i + 5 <= fields.size() && fields[i].op == FormatOp::kHour &&
+               is_colon(fields[i + 1]) && fields[i + 2].op == FormatOp::kMinute &&
+               is_colon(fields[i + 3]) && fields[i + 4].op == FormatOp::kSecond;
+    }
+
+    ZoneSpan& seek(std::int64_t instant, ZoneId zone) {
+        if (last_ >= spans_.size() || spans_[last_].zone != zone) {
+            last_ = 0;
+
+            while (last_ < spans_.size() && spans_[last_].zone != zone) {
+                ++last_;
+            }
+
+            if (last_ == spans_.size()) {
+                spans_.push_back(ZoneSpan{zone, CivilSweep(internal::zone(zone).table),
+                                          CivilDay{1970, 1, 1}, std::string(), {}});
+            }
+        }
+
+        auto& span = spans_[last_];
+
+        if (span.sweep.seek(instant)) {
+            render(&span);
+        }
+
+        return span;
+    }
+
+    void render(ZoneSpan* span) const {
+        const auto& fields = format_.fields();
+        const FormatValue value{span->sweep.day_begin(), 0, span->sweep.offset(), span->zone};
+
+        span->date = span->sweep.date();
+        span->text.clear();
+        span->bounds.assign(1, 0);
+
+        for (const auto& step : steps_) {
+            if (step.kind != StepKind::kText) {
+                continue;
+            }
+
+            for (auto i = step.begin; i < step.end; ++i) {
+                if (fields[i].op == FormatOp::kLiteral) {
+                    const auto literal = format_.literal(fields[i]);
+                    span->text.append(literal.data(), literal.size());
+                } else {
+                    char buffer[32];
+                    char* end = format_.write_field(fields[i], value, span->date, 0, buffer);
+                    span->text.append(buffer, static_cast<std::size_t>(end - buffer));
+                }
+            }
+
+            span->bounds.push_back(static_cast<std::uint32_t>(span->text.size()));
+        }
+    }
+
+    char* write(const ZoneSpan& span, const FormatValue& value, char* out) const {
+        const auto& fields = format_.fields();
+        const auto seconds = static_cast<std::uint64_t>(value.instant - span.sweep.day_begin());
+        std::size_t text = 0;
+
+        for (const auto& step : steps_) {
+            switch (step.kind) {
+                case StepKind::kText: {
+                    const auto begin = span.bounds[text];
+                    const auto size = span.bounds[text + 1] - begin;
+
+                    std::memcpy(out, span.text.data() + begin, size);
+                    out += size;
+                    ++text;
+                    break;
+                }
+                case StepKind::kClock:
+                    out = write_clock(out, seconds);
+                    break;
+                case StepKind::kField:
+                    out = format_.write_field(fields[step.begin], value, span.date, seconds, out);
+                    break;
+            }
+        }
+
+        return out;
+    }
+
+    // Makes room for size more characters. The rows written so far stand for the others, as the
+    // rows of a pattern mostly have the same size.
+    void grow(std::size_t size) {
+        auto& data = out_->data;
+
+        if (data.size() - end_ >= size) {
+            return;
+        }
+
+        const auto written = out_->offsets.size() - 1;
+        const auto expected = written == 0 ? 0 : end_ / written * rows_;
+
+        data.resize(std::max({data.size() * 2, end_ + size, expected + size}));
+    }
+
+    const Format& format_;
+    const std::size_t rows_;
+    StringColumn* out_;
+    std::size_t end_;
+
+    std::vector<Step> steps_;
+    // Spans of the zones met so far, the last one first looked up
+    std::vector<ZoneSpan> spans_;
+    std::size_t last_ = 0;
+};
+
+}  // namespace internal
+
+// Same as from_timestamp() for each timestamp, resolving the zone once
+inline std::vector<DateTime> from_timestamps(const std::vector<time_t>& timestamps,
+                                             internal::string_view tz = "UTC") {
+    const auto zone = internal::zone_id(tz);
+
+    std::vector<DateTime> dts;
+    dts.reserve(timestamps.size());
+
+    for (const auto timestamp : timestamps) {
+        dts.push_back(DateTime::from_instant(timestamp, zone));
+    }
+
+    return dts;
+}
+
+// Civil fields of the timestamps in the timezone, converting sorted runs incrementally
+inline CivilColumns civil_columns(const std::vector<time_t>& timestamps,
+                                  internal::string_view tz = "UTC") {
+    const auto zone = internal::zone_id(tz);
+    internal::CivilSweep sweep(internal::zone(zone).table);
+
+    CivilColumns columns;
+    columns.resize(timestamps.size());
+
+    for (std::size_t i = 0; i < timestamps.size(); ++i) {
+        const auto& f = sweep(timestamps[i]);
+        columns.year[i] = f.year;
+        columns.month[i] = f.month;
+        columns.day[i] = f.day;
+        columns.hour[i] = f.hour;
+        columns.minute[i] = f.minute;
+        columns.second[i] = f.second;
+    }
+
+    return columns;
+}
+
+// Formats the timestamps in the timezone into one buffer, with no string per value. Sorted runs
+// render their date and offset once per local day.
+inline void format_many(const std::vector<time_t>& timestamps, const Format& format,
+                        StringColumn* out, internal::string_view tz = "UTC") {
+    const auto zone = internal::zone_id(tz);
+    internal::ColumnFormatter formatter(format, timestamps.size(), out);
+
+    for (const auto timestamp : timestamps) {
+        formatter.append(timestamp, 0, zone);
+    }
+
+    formatter.finish();
+}
+
+// Same as above, each timestamp in the zone of its row
+inline void format_many(const std::vector<time_t>& timestamps,
+                        const std::vector<internal::ZoneId>& zones, const Format& format,
+                        StringColumn* out) {
+    internal::ColumnFormatter formatter(format, timestamps.size(), out);
+
+    for (std::size_t i = 0; i < timestamps.size(); ++i) {
+        formatter.append(timestamps[i], 0, zones[i]);
+    }
+
+    formatter.finish();
+}
+
+// Same as above for UTC time points, as parse_many() writes them, with their fractions
+inline void format_many(
+        const std::vector<std::chrono::time_point<std::chrono::system_clock,
+                                                  std::chrono::nanoseconds>>& time_points,
+        const Format& format, StringColumn* out, internal::string_view tz = "UTC") {
+    const auto zone = internal::zone_id(tz);
+    internal::ColumnFormatter formatter(format, time_points.size(), out);
+
+    for (const auto& time_point : time_points) {
+        const auto nanos = time_point.time_since_epoch().count();
+        const auto instant = internal::floor_div(nanos, internal::kNanosecondsPerSecond);
+
+        formatter.append(instant, static_cast<std::int32_t>(
+                                          nanos - instant * internal::kNanosecondsPerSecond),
+                         zone);
+    }
+
+    formatter.finish();
+}
+
+}  // namespace pendulum
+
+#endif  // PENDULUM_BATCH_H_
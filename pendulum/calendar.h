@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_CALENDAR_H_
+#define PENDULUM_CALENDAR_H_
+
+#include <cstdint>
+
+#include "pendulum/constants.h"
+
+namespace pendulum {
+namespace internal {
+
+// Proleptic Gregorian calendar arithmetic on plain integers. Every function is a single C++11
+// constexpr expression, so the kernel works in constant expressions and inlines at runtime.
+// Days are counted since 1970-01-01 and years are astronomical (1 BC is year 0).
+
+struct CivilDay {
+    std::int64_t year;
+    int month;
+    int day;
+};
+
+constexpr bool is_leap_year(std::int64_t y) {
+    return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+}
+
+constexpr int days_in_month(std::int64_t y, int m) {
+    return m == 2 ? (is_leap_year(y) ? 29 : 28)
+                  : (m == 4 || m == 6 || m == 9 || m == 11) ? 30 : 31;
+}
+
+constexpr int days_in_year(std::int64_t y) { return is_leap_year(y) ? 366 : 365; }
+
+// Floor division for a positive divisor
+constexpr std::int64_t floor_div(std::int64_t a, std::int64_t b) {
+    return a / b - (a % b < 0 ? 1 : 0);
+}
+
+// Days since March 1st, which puts the leap day at the end of the year
+constexpr int days_since_march(int m, int d) {
+    return (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+}
+
+constexpr std::int64_t days_from_era(std::int64_t era, std::int64_t yoe, int m, int d) {
+    return era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + days_since_march(m, d) - 719468;
+}
+
+constexpr std::int64_t days_from_march_year(std::int64_t y, int m, int d) {
+    return days_from_era(floor_div(y, 400), y - floor_div(y, 400) * 400, m, d);
+}
+
+// Days since 1970-01-01 of the date
+constexpr std::int64_t days_from_civil(std::int64_t y, int m, int d) {
+    return days_from_march_year(m <= 2 ? y - 1 : y, m, d);
+}
+
+constexpr CivilDay civil_from_month_index(std::int64_t era, std::int64_t yoe, std::int64_t doy,
+                                          std::int64_t mp) {
+    return CivilDay{yoe + era * 400 + (mp >= 10 ? 1 : 0),
+                    static_cast<int>(mp < 10 ? mp + 3 : mp - 9),
+                    static_cast<int>(doy - (153 * mp + 2) / 5 + 1)};
+}
+
+constexpr CivilDay civil_from_day_of_year(std::int64_t era, std::int64_t yoe, std::int64_t doy) {
+    return civil_from_month_index(era, yoe, doy, (5 * doy + 2) / 153);
+}
+
+constexpr CivilDay civil_from_year_of_era(std::int64_t era, std::int64_t doe, std::int64_t yoe) {
+    return civil_from_day_of_year(era, yoe, doe - (365 * yoe + yoe / 4 - yoe / 100));
+}
+
+constexpr CivilDay civil_from_day_of_era(std::int64_t era, std::int64_t doe) {
+    return civil_from_year_of_era(era, doe, (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365);
+}
+
+// Date of the days since 1970-01-01
+constexpr CivilDay civil_from_days(std::int64_t days) {
+    return civil_from_day_of_era(floor_div(days + 719468, 146097),
+                                 days + 719468 - floor_div(days + 719468, 146097) * 146097);
+}
+
+// 1-based day of the year
+constexpr int day_of_year(std::int64_t y, int m, int d) {
+    return m > 2 ? days_since_march(m, d) + 60 + (is_leap_year(y) ? 1 : 0)
+                 : (m == 2 ? 31 + d : d);
+}
+
+// 1970-01-01 was a Thursday
+constexpr Weekday weekday_from_days(std::int64_t days) {
+    return static_cast<Weekday>(days + 4 - floor_div(days + 4, 7) * 7);
+}
+
+constexpr Weekday weekday(std::int64_t y, int m, int d) {
+    return weekday_from_days(days_from_civil(y, m, d));
+}
+
+// 1 for Monday through 7 for Sunday
+constexpr int iso_weekday(Weekday weekday) { return weekday == kSunday ? 7 : weekday; }
+
+// A year has 53 ISO weeks when it starts on a Thursday, or on a Wednesday in a leap year
+constexpr int iso_weeks_in_year(std::int64_t y) {
+    return weekday(y, 1, 1) == kThursday || (is_leap_year(y) && weekday(y, 1, 1) == kWednesday)
+                   ? 53
+                   : 52;
+}
+
+// The ordinal week may belong to the last week of the previous year or the first of the next
+constexpr int iso_week_of_ordinal(std::int64_t y, int week) {
+    return week < 1 ? iso_weeks_in_year(y - 1)
+                    : (week == 53 && iso_weeks_in_year(y) == 52 ? 1 : week);
+}
+
+// ISO 8601 week number, i.e. "%V"
+constexpr int iso_week(std::int64_t y, int m, int d) {
+    return iso_week_of_ordinal(y, (day_of_year(y, m, d) - iso_weekday(weekday(y, m, d)) + 10) / 7);
+}
+
+constexpr CivilDay clamp_day(std::int64_t y, int m, int d) {
+    return CivilDay{y, m, d < days_in_month(y, m) ? d : days_in_month(y, m)};
+}
+
+// Date of the months since January of year 0, with the day clamped to the month
+constexpr CivilDay civil_from_months(std::int64_t months, int d) {
+    return clamp_day(floor_div(months, 12),
+                     static_cast<int>(months - floor_div(months, 12) * 12) + 1, d);
+}
+
+// Adds months to the date, clamping the day to the end of the resulting month
+constexpr CivilDay add_months(std::int64_t y, int m, int d, std::int64_t months) {
+    return civil_from_months(y * 12 + m - 1 + months, d);
+}
+
+}  // namespace internal
+}  // namespace pendulum
+
+#endif  // PENDULUM_CALENDAR_H_
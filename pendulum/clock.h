@@ -0,0 +1,242 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_CLOCK_H_
+#define PENDULUM_CLOCK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <time.h>
+
+#include "pendulum/constants.h"
+#include "pendulum/datetime.h"
+#include "pendulum/internal.h"
+#include "pendulum/timezone.h"
+
+namespace pendulum {
+namespace internal {
+
+// UTC time split into seconds and non-negative nanoseconds
+struct Timestamp {
+    std::int64_t seconds;
+    std::int32_t nanos;
+};
+
+template <typename Duration>
+inline Timestamp to_timestamp(
+        const std::chrono::time_point<std::chrono::system_clock, Duration>& tp) {
+    const auto d = tp.time_since_epoch();
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    const auto seconds = floor_div(ns, kNanosecondsPerSecond);
+
+    return Timestamp{seconds, static_cast<std::int32_t>(ns - seconds * kNanosecondsPerSecond)};
+}
+
+// Per-thread cache behind now() and today(). The zone and its offset are resolved again only when
+// the second or the zone name changes, and the day boundaries only when the day changes.
+class NowCache {
+   public:
+    static NowCache& instance() {
+        thread_local NowCache cache;
+        return cache;
+    }
+
+    DateTime now(const Timestamp& ts, string_view tz) {
+        resolve(ts.seconds, tz);
+        return DateTime(ts.seconds, zone_, ts.nanos, offset_);
+    }
+
+    // Start of the local day of the instant, or of the day after (1) or before (-1) it
+    DateTime day(std::int64_t seconds, string_view tz, int days) {
+        resolve(seconds, tz);
+
+        if (seconds < day_begin_ || seconds >= day_end_ || day_zone_ != zone_) {
+            today_ = DateTime(seconds, zone_, 0, offset_).start_of(Unit::kDay);
+            tomorrow_ = today_.add_days(1);
+            yesterday_ = today_.add_days(-1);
+            day_begin_ = today_.timestamp();
+            day_end_ = tomorrow_.timestamp();
+            day_zone_ = zone_;
+        }
+
+        return days == 0 ? today_ : (days > 0 ? tomorrow_ : yesterday_);
+    }
+
+   private:
+    NowCache() = default;
+
+    void resolve(std::int64_t seconds, string_view tz) {
+        if (seconds == second_ && tz == string_view(name_) &&
+            (!local_ || generation_ == ZoneRegistry::instance().local_generation())) {
+            return;
+        }
+
+        auto& registry = ZoneRegistry::instance();
+
+        if (tz != string_view(name_)) {
+            name_.assign(tz.data(), tz.size());
+            local_ = tz == string_view("local");
+            zone_ = kNoZoneId;
+            second_ = std::numeric_limits<std::int64_t>::min();
+        }
+
+        auto id = zone_;
+
+        if (local_) {
+            generation_ = registry.local_generation();
+            id = registry.local();
+        } else if (id == kNoZoneId) {
+            id = zone_id(tz);
+        }
+
+        if (id != zone_ || seconds < begin_ || seconds >= end_) {
+            const auto span = zone(id).table.span(seconds);
+
+            begin_ = span.begin;
+            end_ = span.end;
+            offset_ = span.info.offset;
+        }
+
+        zone_ = id;
+        second_ = seconds;
+    }
+
+    std::string name_;
+    bool local_ = false;
+    std::uint64_t generation_ = 0;
+    ZoneId zone_ = kNoZoneId;
+    std::int64_t second_ = std::numeric_limits<std::int64_t>::min();
+    std::int64_t begin_ = 0;  // UTC instants [begin_, end_) which share offset_
+    std::int64_t end_ = 0;
+    std::int32_t offset_ = 0;
+    ZoneId day_zone_ = kNoZoneId;
+    std::int64_t day_begin_ = 0;  // UTC instants of the local midnights around today_
+    std::int64_t day_end_ = 0;
+    DateTime today_;
+    DateTime tomorrow_;
+    DateTime yesterday_;
+};
+
+}  // namespace internal
+
+// Clock policies chosen at compile time, e.g. now<CoarseClock>("UTC"). Any clock with a static
+// now() returning a std::chrono::system_clock time point works, std::chrono::system_clock included.
+struct SystemClock {
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<std::chrono::system_clock, duration>;
+
+    static time_point now() {
+        return std::chrono::time_point_cast<duration>(std::chrono::system_clock::now());
+    }
+};
+
+// Read from the vDSO without touching the hardware counter, at the cost of a resolution of a few
+// milliseconds (one tick of the kernel)
+struct CoarseClock {
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<std::chrono::system_clock, duration>;
+
+    static time_point now() {
+#ifdef CLOCK_REALTIME_COARSE
+        timespec ts;
+        clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+
+        return time_point(std::chrono::seconds(ts.tv_sec) + duration(ts.tv_nsec));
+#else
+        return SystemClock::now();
+#endif
+    }
+};
+
+// Clock injected per thread with ScopedClock. An instance must not be shared between threads.
+class Clock {
+   public:
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<std::chrono::system_clock, duration>;
+
+    virtual ~Clock() = default;
+
+    virtual time_point read() = 0;
+
+    virtual DateTime now(internal::string_view tz) {
+        return internal::NowCache::instance().now(internal::to_timestamp(read()), tz);
+    }
+
+    // Start of the current local day, or of the day after (1) or before (-1) it
+    virtual DateTime day(internal::string_view tz, int days) {
+        return internal::NowCache::instance().day(internal::to_timestamp(read()).seconds, tz, days);
+    }
+};
+
+// Virtual time for simulations, which advances by one tick on every read
+class TickClock final : public Clock {
+   public:
+    TickClock(const DateTime& start, duration tick)
+            : time_(start.time_point<duration>()), tick_(tick) {}
+
+    time_point read() override {
+        const auto time = time_;
+        time_ += tick_;
+        return time;
+    }
+
+    time_point peek() const { return time_; }
+    void set(const DateTime& dt) { time_ = dt.time_point<duration>(); }
+    void advance(duration d) { time_ += d; }
+
+   private:
+    time_point time_;
+    duration tick_;
+};
+
+namespace internal {
+
+inline Clock*& current_clock() {
+    thread_local Clock* clock = nullptr;
+    return clock;
+}
+
+}  // namespace internal
+
+// Makes now(), today(), tomorrow() and yesterday() of the current thread read the clock until the
+// end of the scope
+class ScopedClock {
+   public:
+    explicit ScopedClock(Clock& clock) : previous_(internal::current_clock()) {
+        internal::current_clock() = &clock;
+    }
+
+    ScopedClock(const ScopedClock&) = delete;
+    ScopedClock& operator=(const ScopedClock&) = delete;
+
+    ~ScopedClock() { internal::current_clock() = previous_; }
+
+   private:
+    Clock* previous_;
+};
+
+}  // namespace pendulum
+
+#endif  // PENDULUM_CLOCK_H_
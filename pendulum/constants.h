@@ -37,16 +37,57 @@ enum Weekday {
     kSaturday,
 };
 
+enum class Unit {
+    kYear,
+    kMonth,
+    kWeek,
+    kDay,
+    kHour,
+    kMinute,
+    kSecond,
+};
+
 namespace internal {
 
 constexpr int kSecondsPerMinute = 60;
 constexpr int kMinutesPerHour = 60;
+constexpr int kHoursPerDay = 24;
+constexpr int kSecondsPerHour = kMinutesPerHour * kSecondsPerMinute;
+constexpr int kSecondsPerDay = kHoursPerDay * kMinutesPerHour * kSecondsPerMinute;
+constexpr int kNanosecondsPerSecond = 1000000000;
+constexpr int kNanosecondsPerMicrosecond = 1000;
 
 inline Weekday& week_starts_at() {
     static Weekday weekday = kMonday;
     return weekday;
 }
 
+inline const char* unit_name(Unit unit) {
+    static const char* const names[] = {"year", "month", "week", "day", "hour", "minute", "second"};
+    return names[static_cast<int>(unit)];
+}
+
+// start_of() and end_of() take singular names like "day", range() takes plural ones like "days"
+inline optional<Unit> to_unit(string_view name, bool plural) {
+    if (plural) {
+        if (name.empty() || name.back() != 's') {
+            return nullopt;
+        }
+
+        name.remove_suffix(1);
+    }
+
+    for (int i = 0; i <= static_cast<int>(Unit::kSecond); ++i) {
+        const auto unit = static_cast<Unit>(i);
+
+        if (name == unit_name(unit)) {
+            return unit;
+        }
+    }
+
+    return nullopt;
+}
+
 }  // namespace internal
 
 }  // namespace pendulum
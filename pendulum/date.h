@@ -23,14 +23,18 @@
 #ifndef PENDULUM_DATE_H_
 #define PENDULUM_DATE_H_
 
+#include <cstdint>
 #include <functional>
 #include <string>
 
 #include <cctz/civil_time.h>
 #include <cctz/time_zone.h>
 
+#include "pendulum/calendar.h"
 #include "pendulum/constants.h"
 #include "pendulum/exceptions.h"
+#include "pendulum/format.h"
+#include "pendulum/internal.h"
 
 namespace pendulum {
 
@@ -42,16 +46,7 @@ class Date {
 
     Date() : ymd_(1970, 1, 1) {}
 
-    Date(int y, int m, int d) {
-        cctz::civil_day ymd(y, m, d);
-
-        if (ymd.year() != y || ymd.month() != m || ymd.day() != d) {
-            throw InvalidDateTime("Invalid date: " + std::to_string(y) + "-" + std::to_string(m) +
-                                  "-" + std::to_string(d));
-        }
-
-        ymd_ = ymd;
-    }
+    Date(int y, int m, int d) : Date(create(y, m, d).value()) {}
 
     explicit Date(const cctz::civil_day& ymd) : ymd_(ymd) {}
     Date(const Date&) = default;
@@ -62,6 +57,17 @@ class Date {
     Date& operator=(const Date&) = default;
     Date& operator=(Date&&) = default;
 
+    // Like the constructor, but reports an invalid date instead of throwing
+    static Expected<Date> create(int y, int m, int d) {
+        const cctz::civil_day ymd(y, m, d);
+
+        if (ymd.year() != y || ymd.month() != m || ymd.day() != d) {
+            return Error(kInvalidDateTime, "Invalid date: ", {y, m, d});
+        }
+
+        return Date(ymd);
+    }
+
     //
     // Attributes
     //
@@ -70,28 +76,17 @@ class Date {
     int month() const { return ymd_.month(); }
     int day() const { return ymd_.day(); }
 
-    Weekday day_of_week() const {
-        auto wday = static_cast<int>(cctz::get_weekday(ymd_));
-        return static_cast<Weekday>((wday + 1) % 7);
-    }
-
-    int day_of_year() const { return cctz::get_yearday(ymd_); }
-    int week_of_month() const { return week_of_year() - day(1).week_of_year() + 1; }
-    int week_of_year() const { return std::stoi(format("%V")); }
+    Weekday day_of_week() const { return internal::weekday(year(), month(), day()); }
+    int day_of_year() const { return internal::day_of_year(year(), month(), day()); }
 
-    bool is_leap_year() const {
-        return (year() % 4 == 0 && year() % 100 != 0) || year() % 400 == 0;
+    int week_of_month() const {
+        return week_of_year() - internal::iso_week(year(), month(), 1) + 1;
     }
 
-    int days_in_month() const {
-        if (month() == 2) {
-            return is_leap_year() ? 29 : 28;
-        }
-        if (month() == 4 || month() == 6 || month() == 9 || month() == 11) {
-            return 30;
-        }
-        return 31;
-    }
+    int week_of_year() const { return internal::iso_week(year(), month(), day()); }
+
+    bool is_leap_year() const { return internal::is_leap_year(year()); }
+    int days_in_month() const { return internal::days_in_month(year(), month()); }
 
     //
     // Fluent helpers
@@ -106,13 +101,32 @@ class Date {
     // String formatting
     //
 
-    std::string to_date_string() const { return format("%Y-%m-%d"); }
+    std::string to_date_string() const { return format(PENDULUM_FORMAT("%Y-%m-%d")); }
 
     std::string format(const std::string& fmt) const {
-        const auto& tz = cctz::utc_time_zone();
-        const auto& tp = cctz::convert(ymd_, tz);
+        return format(internal::cached_format(fmt));
+    }
 
-        return cctz::format(fmt, tp, tz);
+    // Formatted as midnight UTC
+    std::string format(const Format& fmt) const { return fmt.format(format_value()); }
+
+    // Same as DateTime::format_to(), as YYYY-MM-DD by default
+    std::size_t format_to(char* out, std::size_t size) const {
+        return format_to(out, size, PENDULUM_FORMAT("%Y-%m-%d"));
+    }
+
+    std::size_t format_to(char* out, std::size_t size, const Format& fmt) const {
+        return fmt.format_to(format_value(), out, size);
+    }
+
+    template <typename OutputIt>
+    OutputIt format_to(OutputIt out) const {
+        return format_to(out, PENDULUM_FORMAT("%Y-%m-%d"));
+    }
+
+    template <typename OutputIt>
+    OutputIt format_to(OutputIt out, const Format& fmt) const {
+        return fmt.format_to(format_value(), out);
     }
 
     //
@@ -124,28 +138,11 @@ class Date {
     Date add_days(int d) const { return add(0, 0, d); }
 
     Date add(int y, int m, int d) const {
-        int new_year = year() + y;
-        int new_month = month() + m;
-
-        // Adjust month and year
-        if (new_month > 12) {
-            new_year += (new_month - 1) / 12;
-            new_month = (new_month - 1) % 12 + 1;
-        } else if (new_month < 1) {
-            new_year += (new_month - 12) / 12;
-            if ((new_month - 12) % 12 != 0) {
-                new_month = (new_month - 12) % 12 + 12;
-            } else {
-                new_month = 12;
-            }
-        }
-
-        // Clamp day for month addition/subtraction
-        const int days_in_new_month = Date(new_year, new_month, 1).days_in_month();
-        const int clamped_day = std::min(day(), days_in_new_month);
+        // Clamp the day for month arithmetic, then let cctz normalize the day delta
+        const auto ym = internal::add_months(year(), month(), day(),
+                                             static_cast<std::int64_t>(y) * 12 + m);
 
-        // Add the day delta to the clamped day, let cctz handle the normalization
-        return Date(cctz::civil_day(new_year, new_month, clamped_day + d));
+        return Date(cctz::civil_day(ym.year, ym.month, ym.day + d));
     }
 
     Date subtract_years(int y) const { return add_years(-y); }
@@ -171,36 +168,73 @@ class Date {
         return Date(cctz::prev_weekday(ymd_, static_cast<cctz::weekday>(wday)));
     }
 
-    Date start_of(const std::string& unit) const {
-        if (unit == "year") {
-            return start_of_year();
-        }
-        if (unit == "month") {
-            return start_of_month();
-        }
-        if (unit == "day") {
-            return start_of_day();
-        }
-        if (unit == "week") {
-            return start_of_week();
+    // Units finer than a day are invalid for a Date
+    Expected<Date> try_start_of(Unit unit) const {
+        switch (unit) {
+            case Unit::kYear:
+                return start_of_year();
+            case Unit::kMonth:
+                return start_of_month();
+            case Unit::kWeek:
+                return start_of_week();
+            case Unit::kDay:
+                return start_of_day();
+            default:
+                return Error(kInvalidUnit, "unit for start_of(): ", internal::unit_name(unit));
         }
-        throw InvalidUnit("unit for start_of(): " + unit);
     }
 
-    Date end_of(const std::string& unit) const {
-        if (unit == "year") {
-            return end_of_year();
+    Expected<Date> try_end_of(Unit unit) const {
+        switch (unit) {
+            case Unit::kYear:
+                return end_of_year();
+            case Unit::kMonth:
+                return end_of_month();
+            case Unit::kWeek:
+                return end_of_week();
+            case Unit::kDay:
+                return end_of_day();
+            default:
+                return Error(kInvalidUnit, "unit for end_of(): ", internal::unit_name(unit));
         }
-        if (unit == "month") {
-            return end_of_month();
-        }
-        if (unit == "day") {
-            return end_of_day();
+    }
+
+    Date start_of(Unit unit) const { return try_start_of(unit).value(); }
+    Date end_of(Unit unit) const { return try_end_of(unit).value(); }
+
+    template <Unit U>
+    Date start_of() const {
+        static_assert(U <= Unit::kDay, "Date has no time of day");
+        return start_of(U);
+    }
+
+    template <Unit U>
+    Date end_of() const {
+        static_assert(U <= Unit::kDay, "Date has no time of day");
+        return end_of(U);
+    }
+
+    Date start_of(const std::string& unit) const { return try_start_of(unit).value(); }
+    Date end_of(const std::string& unit) const { return try_end_of(unit).value(); }
+
+    Expected<Date> try_start_of(const std::string& unit) const {
+        const auto u = internal::to_unit(unit, false);
+
+        if (!u) {
+            return Error(kInvalidUnit, "unit for start_of(): ", unit);
         }
-        if (unit == "week") {
-            return end_of_week();
+
+        return try_start_of(*u);
+    }
+
+    Expected<Date> try_end_of(const std::string& unit) const {
+        const auto u = internal::to_unit(unit, false);
+
+        if (!u) {
+            return Error(kInvalidUnit, "unit for end_of(): ", unit);
         }
-        throw InvalidUnit("unit for end_of(): " + unit);
+
+        return try_end_of(*u);
     }
 
     //
@@ -212,6 +246,11 @@ class Date {
     const cctz::civil_day& instance() const { return ymd_; }
 
    private:
+    internal::FormatValue format_value() const {
+        const auto days = internal::days_from_civil(year(), month(), day());
+        return internal::FormatValue{days * internal::kSecondsPerDay, 0, 0, internal::kUtcZoneId};
+    }
+
     Date start_of_year() const { return on(year(), 1, 1); }
     Date start_of_month() const { return on(year(), month(), 1); }
     Date start_of_day() const { return *this; }
@@ -239,8 +278,7 @@ class Date {
 };
 
 inline std::ostream& operator<<(std::ostream& out, const Date& date) {
-    out << date.to_date_string();
-    return out;
+    return internal::write_formatted(out, date, PENDULUM_FORMAT("%Y-%m-%d"));
 }
 
 inline bool operator==(const Date& a, const Date& b) { return a.instance() == b.instance(); }
@@ -269,7 +307,8 @@ struct hash<pendulum::Date> {
     hash& operator=(hash&&) = default;
 
     size_t operator()(const pendulum::Date& date) const {
-        return hash<std::string>()(date.to_date_string());
+        const auto days = date.instance() - cctz::civil_day();
+        return static_cast<size_t>(pendulum::internal::hash_mix(static_cast<std::uint64_t>(days)));
     }
 };
 
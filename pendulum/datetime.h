@@ -25,58 +25,102 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <functional>
 #include <string>
+#include <type_traits>
 
 #include <cctz/civil_time.h>
 #include <cctz/time_zone.h>
 
+#include "pendulum/calendar.h"
 #include "pendulum/constants.h"
 #include "pendulum/date.h"
+#include "pendulum/exceptions.h"
+#include "pendulum/format.h"
 #include "pendulum/timezone.h"
 
 namespace pendulum {
 
+namespace internal {
+
+class ColumnParser;
+class NowCache;
+
+}  // namespace internal
+
 class DateTime {
    public:
     //
     // Instantiation
     //
 
-    static const DateTime& epoch() {
-        static DateTime dt(1970, 1, 1, "UTC");
-        return dt;
-    }
+    static DateTime epoch() { return DateTime(); }
 
-    DateTime() { *this = epoch(); }
+    DateTime() : instant_(0), zone_(internal::kUtcZoneId), nanos_(0), offset_(0) {}
 
-    DateTime(const Date& date, const std::string& tz = "UTC")
+    DateTime(const Date& date, internal::string_view tz = "UTC")
             : DateTime(date.year(), date.month(), date.day(), tz) {}
 
-    DateTime(int y, int m, int d, const std::string& tz = "UTC") : DateTime(y, m, d, 0, 0, 0, tz) {}
+    DateTime(int y, int m, int d, internal::string_view tz = "UTC")
+            : DateTime(y, m, d, 0, 0, 0, tz) {}
+
+    DateTime(int y, int m, int d, int hh, int mm = 0, int ss = 0,
+             internal::string_view tz = "UTC")
+            : DateTime(create(y, m, d, hh, mm, ss, tz).value()) {}
+
+    DateTime(const cctz::civil_second& cs, const cctz::time_zone& tz) {
+        assign(cs, internal::ZoneRegistry::instance().intern(tz));
+    }
+
+    DateTime(const cctz::civil_second& cs, internal::ZoneId zone) { assign(cs, zone); }
 
-    DateTime(int y, int m, int d, int hh, int mm = 0, int ss = 0, const std::string& tz = "UTC") {
-        cctz::civil_second cs(y, m, d, hh, mm, ss);
+    // Like the constructor, but reports an invalid datetime or timezone instead of throwing
+    static Expected<DateTime> create(int y, int m, int d, int hh = 0, int mm = 0, int ss = 0,
+                                     internal::string_view tz = "UTC") {
+        const cctz::civil_second cs(y, m, d, hh, mm, ss);
 
         if (cs.year() != y || cs.month() != m || cs.day() != d || cs.hour() != hh ||
             cs.minute() != mm || cs.second() != ss) {
-            throw InvalidDateTime("Invalid datetime: " + std::to_string(y) + "-" +
-                                  std::to_string(m) + "-" + std::to_string(d) + " " +
-                                  std::to_string(hh) + ":" + std::to_string(mm) + ":" +
-                                  std::to_string(ss));
+            return Error(kInvalidDateTime, "Invalid datetime: ", {y, m, d, hh, mm, ss});
         }
 
-        cs_ = cs;
-        tz_ = internal::timezone(tz);
+        const auto zone = internal::try_zone_id(tz);
+
+        if (!zone) {
+            return zone.error();
+        }
+
+        return DateTime(cs, *zone);
+    }
+
+    static DateTime from_instant(std::int64_t instant, internal::ZoneId zone,
+                                 std::int32_t nanos = 0) {
+        return DateTime(instant, zone, nanos, internal::zone(zone).table.lookup(instant).offset);
     }
 
-    DateTime(const cctz::civil_second& cs, const cctz::time_zone& tz) : cs_(cs), tz_(tz) {}
+    template <typename Duration>
+    static DateTime from_time_point(
+            const std::chrono::time_point<std::chrono::system_clock, Duration>& tp,
+            internal::string_view tz = "UTC") {
+        const auto d = tp.time_since_epoch();
+        auto s = std::chrono::duration_cast<std::chrono::seconds>(d);
+
+        // Round toward negative infinity so that the sub-second part is never negative
+        if (s > d) {
+            s -= std::chrono::seconds(1);
+        }
+
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d - s).count();
+
+        return from_instant(s.count(), internal::zone_id(tz), static_cast<std::int32_t>(ns));
+    }
 
     DateTime(const DateTime&) = default;
     DateTime(DateTime&&) = default;
 
-    virtual ~DateTime() = default;
+    ~DateTime() = default;
 
     DateTime& operator=(const DateTime&) = default;
     DateTime& operator=(DateTime&&) = default;
@@ -85,25 +129,31 @@ class DateTime {
     // Attributes
     //
 
-    int year() const { return cs_.year(); }
-    int month() const { return cs_.month(); }
-    int day() const { return cs_.day(); }
-    int hour() const { return cs_.hour(); }
-    int minute() const { return cs_.minute(); }
-    int second() const { return cs_.second(); }
+    int year() const { return instance().year(); }
+    int month() const { return instance().month(); }
+    int day() const { return instance().day(); }
+    int hour() const { return instance().hour(); }
+    int minute() const { return instance().minute(); }
+    int second() const { return instance().second(); }
+    int microsecond() const { return nanosecond() / internal::kNanosecondsPerMicrosecond; }
+    int nanosecond() const { return static_cast<int>(nanos_); }
+
+    Date date() const {
+        const auto cd = internal::civil_from_days(local_days());
+        return Date(cctz::civil_day(cd.year, cd.month, cd.day));
+    }
 
-    Date date() const { return Date(year(), month(), day()); }
-    Weekday day_of_week() const { return date().day_of_week(); }
+    Weekday day_of_week() const { return internal::weekday_from_days(local_days()); }
     int day_of_year() const { return date().day_of_year(); }
     int week_of_month() const { return date().week_of_month(); }
 
     bool is_leap_year() const { return date().is_leap_year(); }
-    bool is_dst() const { return tz_.lookup(cctz::convert(cs_, tz_)).is_dst; }
-    bool is_local() const { return tz_ == cctz::local_time_zone(); }
-    bool is_utc() const { return tz_ == cctz::utc_time_zone(); }
+    bool is_dst() const { return table().lookup(instant_).is_dst != 0; }
+    bool is_local() const { return timezone() == internal::timezone(internal::zone_id("local")); }
+    bool is_utc() const { return zone_id() == internal::kUtcZoneId; }
 
     std::string timezone_name() const {
-        const auto& name = tz_.name();
+        const auto& name = internal::zone(zone_id()).name;
 
         if (name == "/etc/localtime") {
             return "local";
@@ -112,16 +162,28 @@ class DateTime {
         return name;
     }
 
-    int offset() const { return tz_.lookup(cctz::convert(cs_, tz_)).offset; }
+    int offset() const { return static_cast<int>(offset_); }
 
     double offset_hours() const {
         using namespace internal;
         return offset() / kSecondsPerMinute / kMinutesPerHour;
     }
 
-    time_t timestamp() const {
-        const auto& tp = cctz::convert(cs_, tz_);
-        return std::chrono::system_clock::to_time_t(tp);
+    time_t timestamp() const { return static_cast<time_t>(instant_); }
+
+    // Same instant at any resolution, truncated toward negative infinity if coarser than it
+    template <typename Duration = std::chrono::system_clock::duration>
+    std::chrono::time_point<std::chrono::system_clock, Duration> time_point() const {
+        using std::chrono::duration_cast;
+
+        const auto d = std::chrono::seconds(instant_) + std::chrono::nanoseconds(nanosecond());
+        auto rounded = duration_cast<Duration>(d);
+
+        if (rounded > d) {
+            rounded -= Duration(1);
+        }
+
+        return std::chrono::time_point<std::chrono::system_clock, Duration>(rounded);
     }
 
     time_t mktime(std::tm* tm) const {
@@ -170,32 +232,35 @@ class DateTime {
     DateTime year(int y) const { return on(y, month(), day()); }
     DateTime month(int m) const { return on(year(), m, day()); }
     DateTime day(int d) const { return on(year(), month(), d); }
-    DateTime hour(int hh) const { return at(hh, minute(), second()); }
-    DateTime minute(int mm) const { return at(hour(), mm, second()); }
-    DateTime second(int ss) const { return at(hour(), minute(), ss); }
+    DateTime hour(int hh) const { return at(hh, minute(), second()).with_nanos(nanosecond()); }
+    DateTime minute(int mm) const { return at(hour(), mm, second()).with_nanos(nanosecond()); }
+    DateTime second(int ss) const { return at(hour(), minute(), ss).with_nanos(nanosecond()); }
+    DateTime microsecond(int us) const { return with_nanos(0).add_microseconds(us); }
+    DateTime nanosecond(int ns) const { return with_nanos(0).add_nanoseconds(ns); }
 
     DateTime on(int y, int m, int d) const {
         const auto& cs = cctz::civil_second(y, m, d, hour(), minute(), second());
-        return DateTime(cs, tz_);
+        return DateTime(cs, zone_id()).with_nanos(nanosecond());
     }
 
+    // The sub-second part is reset, as in start_of()
     DateTime at(int hh, int mm, int ss) const {
         const auto& cs = cctz::civil_second(year(), month(), day(), hh, mm, ss);
-        return DateTime(cs, tz_);
+        return DateTime(cs, zone_id());
     }
 
-    DateTime timezone(const std::string& name) const {
-        const auto& tz = internal::timezone(name);
-        return DateTime(cs_, tz);
+    DateTime timezone(internal::string_view name) const {
+        return DateTime(instance(), internal::zone_id(name)).with_nanos(nanosecond());
     }
 
     DateTime offset(int seconds) const {
-        return DateTime(cs_, internal::timezone(std::chrono::seconds(seconds)));
+        const auto zone = internal::zone_id(std::chrono::seconds(seconds));
+        return DateTime(instance(), zone).with_nanos(nanosecond());
     }
 
     DateTime offset_hours(int hours, int minutes = 0) const {
         const auto s = std::chrono::hours(hours) + std::chrono::minutes(minutes);
-        return DateTime(cs_, internal::timezone(s));
+        return DateTime(instance(), internal::zone_id(s)).with_nanos(nanosecond());
     }
 
     //
@@ -203,13 +268,49 @@ class DateTime {
     //
 
     std::string to_date_string() const { return date().to_date_string(); }
-    std::string to_time_string() const { return format("%H:%M:%S"); }
-    std::string to_datetime_string() const { return format("%Y-%m-%d %H:%M:%S"); }
-    std::string to_iso8601_string() const { return format("%Y-%m-%dT%H:%M:%S%Ez"); }
+    std::string to_time_string() const { return format(PENDULUM_FORMAT("%H:%M:%S")); }
+    std::string to_datetime_string() const { return format(PENDULUM_FORMAT("%Y-%m-%d %H:%M:%S")); }
 
+    std::string to_iso8601_string() const {
+        return format(PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%E*S%Ez"));
+    }
+
+    // Sub-second digits are available through %E#S, %E*S, %E#f and %E*f
     std::string format(const std::string& fmt) const {
-        const auto tp = cctz::convert(cs_, tz_);
-        return cctz::format(fmt, tp, tz_);
+        return format(internal::cached_format(fmt));
+    }
+
+    std::string format(const Format& fmt) const { return fmt.format(format_value()); }
+
+    // Writes at most size characters, without a terminating null, and returns the size of the
+    // value, as snprintf() does. Size buffers with max_format_size(); no allocation is needed.
+    std::size_t format_to(char* out, std::size_t size) const {
+        return format_to(out, size, PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%E*S%Ez"));
+    }
+
+    std::size_t format_to(char* out, std::size_t size, const Format& fmt) const {
+        return fmt.format_to(format_value(), out, size);
+    }
+
+    // Same as format_to(), through a cache of the thread which keeps the last value of each recent
+    // Format. Values on the same local day and at the same offset, such as the timestamps of
+    // consecutive log lines, only rewrite the digits of the time which changed.
+    std::size_t format_to_cached(char* out, std::size_t size) const {
+        return format_to_cached(out, size, PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%E*S%Ez"));
+    }
+
+    std::size_t format_to_cached(char* out, std::size_t size, const Format& fmt) const {
+        return internal::format_to_cached(fmt, format_value(), out, size);
+    }
+
+    template <typename OutputIt>
+    OutputIt format_to(OutputIt out) const {
+        return format_to(out, PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%E*S%Ez"));
+    }
+
+    template <typename OutputIt>
+    OutputIt format_to(OutputIt out, const Format& fmt) const {
+        return fmt.format_to(format_value(), out);
     }
 
     //
@@ -224,18 +325,69 @@ class DateTime {
     DateTime add_minutes(int mm) const { return add_time(0, mm, 0); }
     DateTime add_seconds(int ss) const { return add_time(0, 0, ss); }
 
+    DateTime add_microseconds(int us) const {
+        return add_nanoseconds(std::int64_t{us} * internal::kNanosecondsPerMicrosecond);
+    }
+
+    DateTime add_nanoseconds(std::int64_t ns) const {
+        using namespace internal;
+
+        // Split before adding the current nanoseconds, which could overflow ns
+        auto seconds = ns / kNanosecondsPerSecond;
+        auto nanos = ns % kNanosecondsPerSecond + nanosecond();
+
+        if (nanos < 0) {
+            --seconds;
+            nanos += kNanosecondsPerSecond;
+        } else if (nanos >= kNanosecondsPerSecond) {
+            ++seconds;
+            nanos -= kNanosecondsPerSecond;
+        }
+
+        // Seconds beyond the range of int, as in large std::chrono durations
+        const auto& cs = cctz::civil_second(year(), month(), day(), hour(), minute(),
+                                            second() + seconds);
+
+        return DateTime(cs, zone_id()).with_nanos(static_cast<std::int32_t>(nanos));
+    }
+
+    DateTime add(Unit unit, int amount) const {
+        switch (unit) {
+            case Unit::kYear:
+                return add_years(amount);
+            case Unit::kMonth:
+                return add_months(amount);
+            case Unit::kWeek:
+                return add_days(amount * 7);
+            case Unit::kDay:
+                return add_days(amount);
+            case Unit::kHour:
+                return add_hours(amount);
+            case Unit::kMinute:
+                return add_minutes(amount);
+            case Unit::kSecond:
+                return add_seconds(amount);
+        }
+        return *this;
+    }
+
+    template <Unit U>
+    DateTime add(int amount) const {
+        return add(U, amount);
+    }
+
     DateTime add_date(int y, int m, int d) const {
         Date new_date = date().add(y, m, d);
         const auto cs = cctz::civil_second(new_date.year(), new_date.month(), new_date.day(),
                                            hour(), minute(), second());
-        return DateTime(cs, tz_);
+        return DateTime(cs, zone_id()).with_nanos(nanosecond());
     }
 
     DateTime add_time(int hh, int mm, int ss) const {
         const auto& cs = cctz::civil_second(year(), month(), day(), hour() + hh, minute() + mm,
                                             second() + ss);
 
-        return DateTime(cs, tz_);
+        return DateTime(cs, zone_id()).with_nanos(nanosecond());
     }
 
     DateTime subtract_years(int y) const { return add_date(-y, 0, 0); }
@@ -245,10 +397,19 @@ class DateTime {
     DateTime subtract_hours(int hh) const { return add_time(-hh, 0, 0); }
     DateTime subtract_minutes(int mm) const { return add_time(0, -mm, 0); }
     DateTime subtract_seconds(int ss) const { return add_time(0, 0, -ss); }
+    DateTime subtract_microseconds(int us) const { return add_microseconds(-us); }
+    DateTime subtract_nanoseconds(std::int64_t ns) const { return add_nanoseconds(-ns); }
 
     DateTime subtract_date(int y, int m, int d) const { return add_date(-y, -m, -d); }
     DateTime subtract_time(int hh, int mm, int ss) const { return add_time(-hh, -mm, -ss); }
 
+    DateTime subtract(Unit unit, int amount) const { return add(unit, -amount); }
+
+    template <Unit U>
+    DateTime subtract(int amount) const {
+        return add(U, -amount);
+    }
+
     //
     // Modifiers
     //
@@ -257,10 +418,10 @@ class DateTime {
 
     DateTime next(Weekday weekday, bool keep_time = false) const {
         const auto cs = DateTime(date().next(weekday)).instance();
-        auto dt = DateTime(cs, tz_);
+        auto dt = DateTime(cs, zone_id());
 
         if (keep_time) {
-            dt = dt.at(hour(), minute(), second());
+            dt = dt.at(hour(), minute(), second()).with_nanos(nanosecond());
         }
 
         return dt;
@@ -270,102 +431,171 @@ class DateTime {
 
     DateTime previous(Weekday weekday, bool keep_time = false) const {
         const auto cs = DateTime(date().previous(weekday)).instance();
-        auto dt = DateTime(cs, tz_);
+        auto dt = DateTime(cs, zone_id());
 
         if (keep_time) {
-            dt = dt.at(hour(), minute(), second());
+            dt = dt.at(hour(), minute(), second()).with_nanos(nanosecond());
         }
 
         return dt;
     }
 
-    DateTime start_of(const std::string& unit) const {
-        if (unit == "year") {
-            return start_of_year();
-        }
-        if (unit == "month") {
-            return start_of_month();
-        }
-        if (unit == "day") {
-            return start_of_day();
-        }
-        if (unit == "hour") {
-            return start_of_hour();
-        }
-        if (unit == "minute") {
-            return start_of_minute();
-        }
-        if (unit == "week") {
-            return start_of_week();
+    DateTime start_of(Unit unit) const {
+        switch (unit) {
+            case Unit::kYear:
+                return start_of_year();
+            case Unit::kMonth:
+                return start_of_month();
+            case Unit::kWeek:
+                return start_of_week();
+            case Unit::kDay:
+                return start_of_day();
+            case Unit::kHour:
+                return start_of_hour();
+            case Unit::kMinute:
+                return start_of_minute();
+            case Unit::kSecond:
+                return start_of_second();
         }
-        throw InvalidUnit("unit for start_of(): " + unit);
+        return *this;
     }
 
-    DateTime end_of(const std::string& unit) const {
-        if (unit == "year") {
-            return end_of_year();
+    DateTime end_of(Unit unit) const {
+        switch (unit) {
+            case Unit::kYear:
+                return end_of_year();
+            case Unit::kMonth:
+                return end_of_month();
+            case Unit::kWeek:
+                return end_of_week();
+            case Unit::kDay:
+                return end_of_day();
+            case Unit::kHour:
+                return end_of_hour();
+            case Unit::kMinute:
+                return end_of_minute();
+            case Unit::kSecond:
+                return end_of_second();
         }
-        if (unit == "month") {
-            return end_of_month();
-        }
-        if (unit == "day") {
-            return end_of_day();
-        }
-        if (unit == "hour") {
-            return end_of_hour();
-        }
-        if (unit == "minute") {
-            return end_of_minute();
-        }
-        if (unit == "week") {
-            return end_of_week();
+        return *this;
+    }
+
+    template <Unit U>
+    DateTime start_of() const {
+        return start_of(U);
+    }
+
+    template <Unit U>
+    DateTime end_of() const {
+        return end_of(U);
+    }
+
+    DateTime start_of(const std::string& unit) const { return try_start_of(unit).value(); }
+    DateTime end_of(const std::string& unit) const { return try_end_of(unit).value(); }
+
+    Expected<DateTime> try_start_of(const std::string& unit) const {
+        const auto u = internal::to_unit(unit, false);
+
+        if (!u) {
+            return Error(kInvalidUnit, "unit for start_of(): ", unit);
         }
-        throw InvalidUnit("unit for end_of(): " + unit);
+
+        return start_of(*u);
     }
 
-    DateTime in_timezone(const std::string& name) const {
-        const auto& tp = cctz::convert(cs_, tz_);
-        const auto& tz = internal::timezone(name);
-        const auto& cs = cctz::convert(tp, tz);
+    Expected<DateTime> try_end_of(const std::string& unit) const {
+        const auto u = internal::to_unit(unit, false);
+
+        if (!u) {
+            return Error(kInvalidUnit, "unit for end_of(): ", unit);
+        }
 
-        return DateTime(cs, tz);
+        return end_of(*u);
     }
 
-    DateTime in_offset(int seconds) const {
-        const auto& tp = cctz::convert(cs_, tz_);
-        const auto& tz = internal::timezone(std::chrono::seconds(seconds));
-        const auto& cs = cctz::convert(tp, tz);
+    DateTime in_timezone(internal::string_view name) const {
+        return in_zone(internal::zone_id(name));
+    }
 
-        return DateTime(cs, tz);
+    DateTime in_offset(int seconds) const {
+        return in_zone(internal::zone_id(std::chrono::seconds(seconds)));
     }
 
     DateTime in_offset_hours(int hours, int minutes = 0) const {
-        const auto& tp = cctz::convert(cs_, tz_);
         const auto s = std::chrono::hours(hours) + std::chrono::minutes(minutes);
-        const auto& tz = internal::timezone(s);
-        const auto& cs = cctz::convert(tp, tz);
-
-        return DateTime(cs, tz);
+        return in_zone(internal::zone_id(s));
     }
 
     //
     // Internals
     //
 
-    const cctz::time_zone& timezone() const { return tz_; }
-    const cctz::civil_second& instance() const { return cs_; }
+    const cctz::time_zone& timezone() const { return internal::timezone(zone_id()); }
+    cctz::civil_second instance() const { return internal::to_civil(instant_ + offset()); }
+    internal::ZoneId zone_id() const { return static_cast<internal::ZoneId>(zone_); }
 
     void instance(const cctz::civil_second& cs, const cctz::time_zone& tz) {
-        cs_ = cs;
-        tz_ = tz;
+        assign(cs, internal::ZoneRegistry::instance().intern(tz));
     }
 
    private:
+    friend class internal::ColumnParser;
+    friend class internal::NowCache;
+
+    DateTime(std::int64_t instant, internal::ZoneId zone, std::int32_t nanos, std::int32_t offset)
+            : instant_(instant), zone_(zone), nanos_(nanos), offset_(offset) {}
+
+    internal::FormatValue format_value() const {
+        return internal::FormatValue{instant_, nanosecond(), offset(), zone_id()};
+    }
+
+    std::int64_t local_days() const {
+        return internal::floor_div(instant_ + offset(), internal::kSecondsPerDay);
+    }
+
+    DateTime with_nanos(std::int32_t nanos) const {
+        return DateTime(instant_, zone_id(), nanos, offset());
+    }
+
+    const internal::TransitionTable& table() const { return internal::zone(zone_id()).table; }
+
+    // Skipped civil times resolve to the transition, like cctz::convert()
+    void assign(const cctz::civil_second& cs, internal::ZoneId zone) {
+        assign(internal::to_seconds(cs), zone);
+    }
+
+    void assign(std::int64_t local, internal::ZoneId zone) {
+        const auto& table = internal::zone(zone).table;
+
+        std::int32_t offset = 0;
+
+        instant_ = table.to_instant(local, &offset);
+        zone_ = zone;
+        nanos_ = 0;
+        offset_ = offset;
+    }
+
+    // Same as at() with the local time truncated to a multiple of seconds, or to the last second
+    // of that multiple
+    DateTime truncate(std::int64_t seconds, bool last = false) const {
+        const auto local = internal::floor_div(instant_ + offset(), seconds) * seconds;
+
+        DateTime dt;
+        dt.assign(last ? local + seconds - 1 : local, zone_id());
+
+        return dt;
+    }
+
+    DateTime in_zone(internal::ZoneId zone) const {
+        return from_instant(instant_, zone, nanosecond());
+    }
+
     DateTime start_of_year() const { return on(year(), 1, 1).at(0, 0, 0); }
     DateTime start_of_month() const { return on(year(), month(), 1).at(0, 0, 0); }
-    DateTime start_of_day() const { return at(0, 0, 0); }
-    DateTime start_of_hour() const { return at(hour(), 0, 0); }
-    DateTime start_of_minute() const { return at(hour(), minute(), 0); }
+    DateTime start_of_day() const { return truncate(internal::kSecondsPerDay); }
+    DateTime start_of_hour() const { return truncate(internal::kSecondsPerHour); }
+    DateTime start_of_minute() const { return truncate(internal::kSecondsPerMinute); }
+    DateTime start_of_second() const { return with_nanos(0); }
 
     DateTime start_of_week() const {
         const auto wday = internal::week_starts_at();
@@ -379,47 +609,48 @@ class DateTime {
 
     DateTime end_of_year() const { return on(year(), 12, 31).at(23, 59, 59); }
     DateTime end_of_month() const { return on(year(), month() + 1, 1).add_days(-1).at(23, 59, 59); }
-    DateTime end_of_day() const { return at(23, 59, 59); }
-    DateTime end_of_hour() const { return at(hour(), 59, 59); }
-    DateTime end_of_minute() const { return at(hour(), minute(), 59); }
+    DateTime end_of_day() const { return truncate(internal::kSecondsPerDay, true); }
+    DateTime end_of_hour() const { return truncate(internal::kSecondsPerHour, true); }
+    DateTime end_of_minute() const { return truncate(internal::kSecondsPerMinute, true); }
+    DateTime end_of_second() const { return with_nanos(0); }
 
     DateTime end_of_week() const {
         const auto weekday = internal::week_starts_at();
         return next(weekday).add_days(-1).at(23, 59, 59);
     }
 
-    cctz::civil_second cs_;
-    cctz::time_zone tz_;
+    // UTC seconds, then the interned zone, nanoseconds within the second and the offset in effect
+    // at the instant packed into another 64 bits. Civil fields are derived without a lookup.
+    std::int64_t instant_;
+    std::uint64_t zone_ : 16;
+    std::uint64_t nanos_ : 30;
+    std::int64_t offset_ : 18;
 };
 
+static_assert(internal::kZoneChunkSize * internal::kMaxZoneChunks <= 1 << 16,
+              "Zone ids should fit in DateTime");
+static_assert(sizeof(DateTime) == 16, "DateTime should stay within 16 bytes");
+static_assert(std::is_trivially_copyable<DateTime>::value,
+              "DateTime should be trivially copyable");
+
 inline std::ostream& operator<<(std::ostream& out, const DateTime& dt) {
-    out << dt.to_iso8601_string();
-    return out;
+    return internal::write_formatted(out, dt, PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%E*S%Ez"));
 }
 
 inline bool operator==(const DateTime& a, const DateTime& b) {
-    return a.timestamp() == b.timestamp();
+    return a.timestamp() == b.timestamp() && a.nanosecond() == b.nanosecond();
 }
 
-inline bool operator!=(const DateTime& a, const DateTime& b) {
-    return a.timestamp() != b.timestamp();
-}
+inline bool operator!=(const DateTime& a, const DateTime& b) { return !(a == b); }
 
 inline bool operator<(const DateTime& a, const DateTime& b) {
-    return a.timestamp() < b.timestamp();
-}
-
-inline bool operator<=(const DateTime& a, const DateTime& b) {
-    return a.timestamp() <= b.timestamp();
+    return a.timestamp() < b.timestamp() ||
+           (a.timestamp() == b.timestamp() && a.nanosecond() < b.nanosecond());
 }
 
-inline bool operator>(const DateTime& a, const DateTime& b) {
-    return a.timestamp() > b.timestamp();
-}
-
-inline bool operator>=(const DateTime& a, const DateTime& b) {
-    return a.timestamp() >= b.timestamp();
-}
+inline bool operator<=(const DateTime& a, const DateTime& b) { return !(b < a); }
+inline bool operator>(const DateTime& a, const DateTime& b) { return b < a; }
+inline bool operator>=(const DateTime& a, const DateTime& b) { return !(a < b); }
 
 }  // namespace pendulum
 
@@ -440,7 +671,7 @@ struct hash<pendulum::DateTime> {
     hash& operator=(hash&&) = default;
 
     size_t operator()(const pendulum::DateTime& dt) const {
-        return hash<std::string>()(dt.to_iso8601_string());
+        return pendulum::internal::hash_instant(dt.timestamp(), dt.nanosecond());
     }
 };
 
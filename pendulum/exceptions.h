@@ -23,8 +23,20 @@
 #ifndef PENDULUM_EXCEPTIONS_H_
 #define PENDULUM_EXCEPTIONS_H_
 
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <exception>
+#include <initializer_list>
 #include <string>
+#include <utility>
+
+#include "pendulum/internal.h"
+
+#if !defined(PENDULUM_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(__EXCEPTIONS)
+#define PENDULUM_NO_EXCEPTIONS
+#endif
 
 namespace pendulum {
 
@@ -98,6 +110,153 @@ class UnsupportedFormat : public PendulumException {
     UnsupportedFormat& operator=(UnsupportedFormat&&) = default;
 };
 
+enum ErrorCode {
+    kNoError,
+    kInvalidDateTime,
+    kInvalidUnit,
+    kInvalidTimezone,
+    kUnsupportedFormat,
+};
+
+// Records why a try_ function failed without allocating or formatting anything. The input is
+// copied into inline buffers, truncated when longer, and message() builds the text on demand.
+class Error {
+   public:
+    Error() = default;
+
+    Error(ErrorCode code, const char* prefix, internal::string_view text,
+          internal::string_view format = internal::string_view())
+            : code_(code), prefix_(prefix) {
+        text_.assign(text);
+        format_.assign(format);
+    }
+
+    Error(ErrorCode code, const char* prefix, std::initializer_list<int> fields)
+            : code_(code), prefix_(prefix) {
+        for (const auto field : fields) {
+            if (size_ < kMaxFields) {
+                fields_[size_++] = field;
+            }
+        }
+    }
+
+    ErrorCode code() const { return code_; }
+    explicit operator bool() const { return code_ != kNoError; }
+
+    std::string message() const {
+        static const char* const separators[kMaxFields] = {"", "-", "-", " ", ":", ":"};
+
+        std::string message(prefix_);
+
+        for (int i = 0; i < size_; ++i) {
+            message += separators[i];
+            message += std::to_string(fields_[i]);
+        }
+
+        text_.append_to(&message);
+
+        if (!format_.empty()) {
+            message += " - format: ";
+            format_.append_to(&message);
+        }
+
+        return message;
+    }
+
+   private:
+    static constexpr int kMaxFields = 6;
+
+    template <std::size_t N>
+    class Text {
+       public:
+        void assign(internal::string_view text) {
+            size_ = text.size();
+
+            if (size_ > 0) {
+                std::memcpy(data_, text.data(), size_ < N ? size_ : N);
+            }
+        }
+
+        bool empty() const { return size_ == 0; }
+
+        void append_to(std::string* out) const {
+            out->append(data_, size_ < N ? size_ : N);
+
+            if (size_ > N) {
+                out->append("...");
+            }
+        }
+
+       private:
+        char data_[N] = {};
+        std::size_t size_ = 0;
+    };
+
+    ErrorCode code_ = kNoError;
+    const char* prefix_ = "";
+    Text<64> text_;
+    Text<32> format_;
+    int fields_[kMaxFields] = {};
+    int size_ = 0;
+};
+
+namespace internal {
+
+// Throws the exception matching the error, or aborts when exceptions are disabled
+[[noreturn]] inline void raise(const Error& error) {
+#ifdef PENDULUM_NO_EXCEPTIONS
+    std::fprintf(stderr, "pendulum: %s\n", error.message().c_str());
+    std::abort();
+#else
+    switch (error.code()) {
+        case kInvalidDateTime:
+            throw InvalidDateTime(error.message());
+        case kInvalidUnit:
+            throw InvalidUnit(error.message());
+        case kInvalidTimezone:
+            throw InvalidTimezone(error.message());
+        case kUnsupportedFormat:
+            throw UnsupportedFormat(error.message());
+        default:
+            throw PendulumException(error.message());
+    }
+#endif
+}
+
+}  // namespace internal
+
+// Either a value or the Error which prevented it, returned by the try_ functions
+template <typename T>
+class Expected {
+   public:
+    Expected(const T& value) : value_(value) {}
+    Expected(T&& value) : value_(std::move(value)) {}
+    Expected(const Error& error) : error_(error) {}
+
+    bool has_value() const { return value_.has_value(); }
+    explicit operator bool() const { return has_value(); }
+
+    const T& operator*() const { return *value_; }
+    const T* operator->() const { return &*value_; }
+
+    // Raises the error like the throwing API does
+    const T& value() const {
+        if (!value_) {
+            internal::raise(error_);
+        }
+
+        return *value_;
+    }
+
+    T value_or(const T& fallback) const { return value_ ? *value_ : fallback; }
+
+    const Error& error() const { return error_; }
+
+   private:
+    internal::optional<T> value_;
+    Error error_;
+};
+
 }  // namespace pendulum
 
 #endif  // PENDULUM_EXCEPTIONS_H_
@@ -0,0 +1,280 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_FIXED_OFFSET_DATETIME_H_
+#define PENDULUM_FIXED_OFFSET_DATETIME_H_
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include "pendulum/calendar.h"
+#include "pendulum/constants.h"
+#include "pendulum/date.h"
+#include "pendulum/datetime.h"
+#include "pendulum/exceptions.h"
+#include "pendulum/format.h"
+#include "pendulum/timezone.h"
+#include "pendulum/transitions.h"
+
+namespace pendulum {
+
+// DateTime whose offset from UTC is fixed at compile time.
+//
+// It keeps the UTC instant only, so timestamp(), offset() and comparisons never consult a
+// timezone and civil fields are derived with plain arithmetic. It converts implicitly to DateTime
+// and can be constructed explicitly from one.
+template <int Offset>
+class FixedOffsetDateTime {
+    static_assert(-86400 < Offset && Offset < 86400, "offset must be less than a day");
+
+   public:
+    //
+    // Instantiation
+    //
+
+    constexpr FixedOffsetDateTime() : instant_(0) {}
+
+    FixedOffsetDateTime(int y, int m, int d, int hh = 0, int mm = 0, int ss = 0)
+            : FixedOffsetDateTime(create(y, m, d, hh, mm, ss).value()) {}
+
+    explicit FixedOffsetDateTime(const Date& date)
+            : FixedOffsetDateTime(date.year(), date.month(), date.day()) {}
+
+    explicit FixedOffsetDateTime(const DateTime& dt) : instant_(dt.timestamp()) {}
+
+    FixedOffsetDateTime(const FixedOffsetDateTime&) = default;
+    FixedOffsetDateTime(FixedOffsetDateTime&&) = default;
+
+    ~FixedOffsetDateTime() = default;
+
+    FixedOffsetDateTime& operator=(const FixedOffsetDateTime&) = default;
+    FixedOffsetDateTime& operator=(FixedOffsetDateTime&&) = default;
+
+    static FixedOffsetDateTime from_timestamp(time_t timestamp) {
+        FixedOffsetDateTime dt;
+        dt.instant_ = timestamp;
+        return dt;
+    }
+
+    static Expected<FixedOffsetDateTime> create(int y, int m, int d, int hh = 0, int mm = 0,
+                                                int ss = 0) {
+        const cctz::civil_second cs(y, m, d, hh, mm, ss);
+
+        if (cs.year() != y || cs.month() != m || cs.day() != d || cs.hour() != hh ||
+            cs.minute() != mm || cs.second() != ss) {
+            return Error(kInvalidDateTime, "Invalid datetime: ", {y, m, d, hh, mm, ss});
+        }
+
+        return from_timestamp(static_cast<time_t>(internal::to_seconds(cs) - Offset));
+    }
+
+    operator DateTime() const { return DateTime::from_instant(instant_, zone_id()); }
+
+    //
+    // Attributes
+    //
+
+    int year() const { return instance().year(); }
+    int month() const { return instance().month(); }
+    int day() const { return instance().day(); }
+    int hour() const { return instance().hour(); }
+    int minute() const { return instance().minute(); }
+    int second() const { return instance().second(); }
+
+    Date date() const { return Date(cctz::civil_day(instance())); }
+    Weekday day_of_week() const {
+        return internal::weekday_from_days(
+                internal::floor_div(instant_ + Offset, internal::kSecondsPerDay));
+    }
+    int day_of_year() const { return date().day_of_year(); }
+    int week_of_month() const { return date().week_of_month(); }
+
+    bool is_leap_year() const { return date().is_leap_year(); }
+    constexpr bool is_dst() const { return false; }
+    constexpr bool is_utc() const { return Offset == 0; }
+
+    std::string timezone_name() const { return internal::zone(zone_id()).name; }
+
+    constexpr int offset() const { return Offset; }
+
+    constexpr double offset_hours() const {
+        return static_cast<double>(Offset) / internal::kSecondsPerMinute /
+               internal::kMinutesPerHour;
+    }
+
+    time_t timestamp() const { return static_cast<time_t>(instant_); }
+
+    //
+    // String formatting
+    //
+
+    std::string to_date_string() const { return format(PENDULUM_FORMAT("%Y-%m-%d")); }
+    std::string to_time_string() const { return format(PENDULUM_FORMAT("%H:%M:%S")); }
+    std::string to_datetime_string() const { return format(PENDULUM_FORMAT("%Y-%m-%d %H:%M:%S")); }
+
+    std::string to_iso8601_string() const {
+        return format(PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%S%Ez"));
+    }
+
+    std::string format(const std::string& fmt) const {
+        return format(internal::cached_format(fmt));
+    }
+
+    std::string format(const Format& fmt) const { return fmt.format(format_value()); }
+
+    // Same as DateTime::format_to()
+    std::size_t format_to(char* out, std::size_t size) const {
+        return format_to(out, size, PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%S%Ez"));
+    }
+
+    std::size_t format_to(char* out, std::size_t size, const Format& fmt) const {
+        return fmt.format_to(format_value(), out, size);
+    }
+
+    template <typename OutputIt>
+    OutputIt format_to(OutputIt out) const {
+        return format_to(out, PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%S%Ez"));
+    }
+
+    template <typename OutputIt>
+    OutputIt format_to(OutputIt out, const Format& fmt) const {
+        return fmt.format_to(format_value(), out);
+    }
+
+    //
+    // Additions and Subtractions
+    //
+
+    FixedOffsetDateTime add_years(int y) const { return add_date(y, 0, 0); }
+    FixedOffsetDateTime add_months(int m) const { return add_date(0, m, 0); }
+    FixedOffsetDateTime add_days(int d) const { return add_time(d * 24, 0, 0); }
+
+    FixedOffsetDateTime add_hours(int hh) const { return add_time(hh, 0, 0); }
+    FixedOffsetDateTime add_minutes(int mm) const { return add_time(0, mm, 0); }
+    FixedOffsetDateTime add_seconds(int ss) const { return add_time(0, 0, ss); }
+
+    FixedOffsetDateTime add_date(int y, int m, int d) const {
+        const auto& cs = instance();
+        const auto& new_date = date().add(y, m, d);
+        const auto new_cs = cctz::civil_second(new_date.year(), new_date.month(), new_date.day(),
+                                               cs.hour(), cs.minute(), cs.second());
+
+        return from_timestamp(internal::to_seconds(new_cs) - Offset);
+    }
+
+    FixedOffsetDateTime add_time(int hh, int mm, int ss) const {
+        const auto seconds = (static_cast<std::int64_t>(hh) * internal::kMinutesPerHour + mm) *
+                                     internal::kSecondsPerMinute +
+                             ss;
+
+        return from_timestamp(instant_ + seconds);
+    }
+
+    FixedOffsetDateTime subtract_years(int y) const { return add_years(-y); }
+    FixedOffsetDateTime subtract_months(int m) const { return add_months(-m); }
+    FixedOffsetDateTime subtract_days(int d) const { return add_days(-d); }
+
+    FixedOffsetDateTime subtract_hours(int hh) const { return add_hours(-hh); }
+    FixedOffsetDateTime subtract_minutes(int mm) const { return add_minutes(-mm); }
+    FixedOffsetDateTime subtract_seconds(int ss) const { return add_seconds(-ss); }
+
+    //
+    // Internals
+    //
+
+    cctz::civil_second instance() const { return internal::to_civil(instant_ + Offset); }
+
+    static internal::ZoneId zone_id() {
+        return internal::zone_id(std::chrono::seconds(Offset));
+    }
+
+    friend bool operator==(const FixedOffsetDateTime& a, const FixedOffsetDateTime& b) {
+        return a.instant_ == b.instant_;
+    }
+
+    friend bool operator!=(const FixedOffsetDateTime& a, const FixedOffsetDateTime& b) {
+        return a.instant_ != b.instant_;
+    }
+
+    friend bool operator<(const FixedOffsetDateTime& a, const FixedOffsetDateTime& b) {
+        return a.instant_ < b.instant_;
+    }
+
+    friend bool operator<=(const FixedOffsetDateTime& a, const FixedOffsetDateTime& b) {
+        return a.instant_ <= b.instant_;
+    }
+
+    friend bool operator>(const FixedOffsetDateTime& a, const FixedOffsetDateTime& b) {
+        return a.instant_ > b.instant_;
+    }
+
+    friend bool operator>=(const FixedOffsetDateTime& a, const FixedOffsetDateTime& b) {
+        return a.instant_ >= b.instant_;
+    }
+
+   private:
+    internal::FormatValue format_value() const {
+        return internal::FormatValue{instant_, 0, Offset, zone_id()};
+    }
+
+    std::int64_t instant_;
+};
+
+using UtcDateTime = FixedOffsetDateTime<0>;
+
+template <int Offset>
+inline std::ostream& operator<<(std::ostream& out, const FixedOffsetDateTime<Offset>& dt) {
+    return internal::write_formatted(out, dt, PENDULUM_FORMAT("%Y-%m-%dT%H:%M:%S%Ez"));
+}
+
+}  // namespace pendulum
+
+namespace std {
+
+template <int Offset>
+struct hash<pendulum::FixedOffsetDateTime<Offset>> {
+    using result_type = size_t;
+    using argument_type = pendulum::FixedOffsetDateTime<Offset>;
+
+    hash() = default;
+    hash(const hash&) = default;
+    hash(hash&&) = default;
+
+    virtual ~hash() = default;
+
+    hash& operator=(const hash&) = default;
+    hash& operator=(hash&&) = default;
+
+    size_t operator()(const pendulum::FixedOffsetDateTime<Offset>& dt) const {
+        return pendulum::internal::hash_instant(dt.timestamp());
+    }
+};
+
+}  // namespace std
+
+#endif  // PENDULUM_FIXED_OFFSET_DATETIME_H_
@@ -0,0 +1,881 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_FORMAT_H_
+#define PENDULUM_FORMAT_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <cctz/time_zone.h>
+
+#include "pendulum/calendar.h"
+#include "pendulum/constants.h"
+#include "pendulum/internal.h"
+#include "pendulum/timezone.h"
+
+namespace pendulum {
+
+namespace internal {
+
+// Operations a pattern compiles to. Composite specifiers such as %F and %T are expanded.
+enum class FormatOp : std::uint8_t {
+    kLiteral,
+    kYear,
+    kShortYear,
+    kMonth,
+    kDay,
+    kSpacedDay,
+    kDayOfYear,
+    kHour,
+    kMinute,
+    kSecond,
+    kFraction,
+    kOffset,
+};
+
+// Fields which change within a day at a given offset
+constexpr bool is_time_of_day(FormatOp op) {
+    return op == FormatOp::kHour || op == FormatOp::kMinute || op == FormatOp::kSecond ||
+           op == FormatOp::kFraction;
+}
+
+// Width of a kFraction which keeps every significant digit, as in %E*S and %E*f
+constexpr std::uint8_t kAllDigits = 0xff;
+
+// Styles of a kOffset: %z, %Ez and %E*z
+enum OffsetStyle : std::uint8_t { kHoursMinutes, kHoursColonMinutes, kHoursColonMinutesSeconds };
+
+struct FormatField {
+    FormatOp op;
+    // Digits of a kFraction, or style of a kOffset
+    std::uint8_t width;
+    // The kFraction is preceded by a dot, as in %E#S and %E*S
+    bool dot;
+    // Characters of a kLiteral
+    std::uint32_t begin;
+    std::uint32_t size;
+};
+
+// Instant to format, with the offset in effect at it
+struct FormatValue {
+    std::int64_t instant;
+    std::int32_t nanos;
+    std::int32_t offset;
+    ZoneId zone;
+};
+
+constexpr std::int32_t kPowersOf10[] = {1,      10,      100,      1000,      10000,
+                                        100000, 1000000, 10000000, 100000000, 1000000000};
+
+// Writes value, below 100, as two digits
+inline char* write_pair(char* out, std::uint64_t value) {
+    std::memcpy(out,
+                "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899" +
+                        value * 2,
+                2);
+
+    return out + 2;
+}
+
+// Writes the lowest width digits of value
+inline char* write_digits(char* out, std::uint64_t value, int width) {
+    for (auto i = width - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+
+    return out + width;
+}
+
+inline char* write_integer(char* out, std::int64_t value) {
+    auto magnitude = static_cast<std::uint64_t>(value);
+
+    if (value < 0) {
+        *out++ = '-';
+        magnitude = ~magnitude + 1;
+    }
+
+    int width = 1;
+
+    for (auto rest = magnitude / 10; rest != 0; rest /= 10) {
+        ++width;
+    }
+
+    return write_digits(out, magnitude, width);
+}
+
+inline char* write_fraction(char* out, std::int32_t nanos, std::uint8_t width, bool dot) {
+    if (width == kAllDigits) {
+        // Trailing zeros are dropped, and so is the dot of a whole second
+        if (nanos == 0) {
+            if (!dot) {
+                *out++ = '0';
+            }
+
+            return out;
+        }
+
+        int digits = 9;
+
+        while (nanos % 10 == 0) {
+            nanos /= 10;
+            --digits;
+        }
+
+        if (dot) {
+            *out++ = '.';
+        }
+
+        return write_digits(out, static_cast<std::uint64_t>(nanos), digits);
+    }
+
+    if (width == 0) {
+        return out;
+    }
+
+    if (dot) {
+        *out++ = '.';
+    }
+
+    return write_digits(out, static_cast<std::uint64_t>(nanos / kPowersOf10[9 - width]), width);
+}
+
+// Offsets are truncated to the style, as by cctz
+inline char* write_offset(char* out, std::int32_t offset, std::uint8_t style) {
+    *out++ = offset < 0 ? '-' : '+';
+
+    const auto magnitude = static_cast<std::uint64_t>(offset < 0 ? -offset : offset);
+
+    out = write_pair(out, magnitude / 3600);
+
+    if (style != kHoursMinutes) {
+        *out++ = ':';
+    }
+
+    out = write_pair(out, magnitude / 60 % 60);
+
+    if (style == kHoursColonMinutesSeconds) {
+        *out++ = ':';
+        out = write_pair(out, magnitude % 60);
+    }
+
+    return out;
+}
+
+// Size of a pattern which Format does not write natively
+constexpr std::size_t kUnboundedSize = static_cast<std::size_t>(-1);
+
+constexpr bool is_format_digit(char c) { return c >= '0' && c <= '9'; }
+
+// Upper bounds below mirror those of Format::compile(), for the specifier after a '%' or a '%E'
+constexpr std::size_t extension_size(const char* p) {
+    return *p == 'z'   ? 6
+           : *p == '*' ? (p[1] == 'z' ? 9 : p[1] == 'S' ? 12 : p[1] == 'f' ? 9 : kUnboundedSize)
+           : is_format_digit(*p) && !is_format_digit(p[1])
+                   ? (p[1] == 'S'   ? 3 + static_cast<std::size_t>(*p - '0')
+                      : p[1] == 'f' ? static_cast<std::size_t>(*p - '0')
+                                    : kUnboundedSize)
+                   : kUnboundedSize;
+}
+
+constexpr std::size_t specifier_size(const char* p) {
+    return *p == 'Y'   ? 20
+           : *p == 'j' ? 3
+           : *p == 'y' || *p == 'm' || *p == 'd' || *p == 'e' || *p == 'H' || *p == 'M' ||
+                             *p == 'S'
+                   ? 2
+           : *p == 'z' ? 5
+           : *p == '%' ? 1
+           : *p == 'F' ? 26
+           : *p == 'T' ? 8
+           : *p == 'R' ? 5
+           : *p == 'E' ? extension_size(p + 1)
+                       : kUnboundedSize;
+}
+
+constexpr std::size_t specifier_length(const char* p) {
+    return *p != 'E' ? 1 : p[1] == 'z' ? 2 : 3;
+}
+
+constexpr std::size_t add_format_sizes(std::size_t a, std::size_t b) {
+    return a == kUnboundedSize || b == kUnboundedSize ? kUnboundedSize : a + b;
+}
+
+constexpr std::size_t max_format_size(const char* p) {
+    return *p == '\0'  ? 0
+           : *p != '%' ? add_format_sizes(1, max_format_size(p + 1))
+           : specifier_size(p + 1) == kUnboundedSize
+                   ? kUnboundedSize
+                   : add_format_sizes(specifier_size(p + 1),
+                                      max_format_size(p + 1 + specifier_length(p + 1)));
+}
+
+class ColumnFormatter;
+class FormatCache;
+
+}  // namespace internal
+
+// Upper bound of the size of a formatted pattern known at compile time, to size buffers on the
+// stack. Patterns with specifiers which are not written natively, such as %a or %Z, have no bound,
+// and a buffer of that size fails to compile.
+constexpr std::size_t max_format_size(const char* pattern) {
+    return internal::max_format_size(pattern);
+}
+
+// strftime-style pattern compiled once into a sequence of fields, for formatting and parsing.
+//
+// The syntax is that of cctz. Patterns whose specifiers are all numeric fields or offsets (%Y, %y,
+// %m, %d, %e, %j, %H, %M, %S, %F, %T, %R, %E#S, %E*S, %E#f, %E*f, %z, %Ez, %E*z and %%) are
+// formatted without cctz, and parsed without it when the input has the canonical widths. Other
+// patterns and inputs go through cctz::format() and cctz::parse().
+class Format {
+   public:
+    Format() : Format(internal::string_view()) {}
+
+    explicit Format(internal::string_view pattern) : pattern_(pattern.data(), pattern.size()) {
+        compile();
+    }
+
+    Format(const Format&) = default;
+    Format(Format&&) = default;
+
+    ~Format() = default;
+
+    Format& operator=(const Format&) = default;
+    Format& operator=(Format&&) = default;
+
+    const std::string& pattern() const { return pattern_; }
+
+    // Fields of a native pattern
+    const std::vector<internal::FormatField>& fields() const { return fields_; }
+
+    internal::string_view literal(const internal::FormatField& field) const {
+        return internal::string_view(literals_.data() + field.begin, field.size);
+    }
+
+    bool formats_natively() const { return formats_natively_; }
+    bool parses_natively() const { return parses_natively_; }
+
+    // cctz cannot parse '%Y%m%d', whose year takes every digit but the last four
+    bool is_ymd() const { return ymd_; }
+
+    // Upper bound of the size of a natively formatted value
+    std::size_t max_size() const { return max_size_; }
+
+    std::string format(const internal::FormatValue& value) const {
+        if (!formats_natively_) {
+            const auto tp = cctz::time_point<cctz::seconds>(cctz::seconds(value.instant));
+            const auto fs = cctz::detail::femtoseconds(std::int64_t{value.nanos} * 1000000);
+
+            return cctz::detail::format(pattern_, tp, fs, internal::timezone(value.zone));
+        }
+
+        char buffer[kBufferSize];
+
+        if (max_size_ <= sizeof(buffer)) {
+            return std::string(buffer, write(value, buffer));
+        }
+
+        std::string out(max_size_, '\0');
+        out.resize(static_cast<std::size_t>(write(value, &out[0]) - out.data()));
+
+        return out;
+    }
+
+    // Writes at most size characters of the value to out, without a terminating null, and returns
+    // the size of the whole value, as snprintf() does. Native patterns need no allocation.
+    std::size_t format_to(const internal::FormatValue& value, char* out, std::size_t size) const {
+        if (formats_natively_ && max_size_ <= size) {
+            return static_cast<std::size_t>(write(value, out) - out);
+        }
+
+        char buffer[kBufferSize];
+
+        if (formats_natively_ && max_size_ <= sizeof(buffer)) {
+            const auto n = static_cast<std::size_t>(write(value, buffer) - buffer);
+            std::memcpy(out, buffer, n < size ? n : size);
+
+            return n;
+        }
+
+        const auto formatted = format(value);
+        std::memcpy(out, formatted.data(), formatted.size() < size ? formatted.size() : size);
+
+        return formatted.size();
+    }
+
+    template <typename OutputIt>
+    OutputIt format_to(const internal::FormatValue& value, OutputIt out) const {
+        char buffer[kBufferSize];
+
+        if (formats_natively_ && max_size_ <= sizeof(buffer)) {
+            return std::copy(buffer, write(value, buffer), out);
+        }
+
+        const auto formatted = format(value);
+        return std::copy(formatted.begin(), formatted.end(), out);
+    }
+
+    // Formats a native pattern into out, which holds at least max_size() characters, and returns
+    // the end of the value
+    char* write(const internal::FormatValue& value, char* out) const {
+        using namespace internal;
+
+        const auto local = value.instant + value.offset;
+        const auto days = floor_div(local, kSecondsPerDay);
+        const auto seconds = static_cast<std::uint64_t>(local - days * kSecondsPerDay);
+        const auto date = civil_from_days(days);
+
+        auto field = fields_.begin();
+
+        // A leading YYYY-MM-DD, and the time after it, at fixed positions. %Y has no padding.
+        if (fixed_fields_ != 0 && date.year >= 1000 && date.year <= 9999) {
+            const auto year = static_cast<std::uint64_t>(date.year);
+
+            out = write_pair(out, year / 100);
+            out = write_pair(out, year % 100);
+            *out++ = '-';
+            out = write_pair(out, static_cast<std::uint64_t>(date.month));
+            *out++ = '-';
+            out = write_pair(out, static_cast<std::uint64_t>(date.day));
+
+            if (fixed_fields_ == kFixedDateTimeFields) {
+                *out++ = literals_[fields_[kFixedDateFields].begin];
+                out = write_pair(out, seconds / 3600);
+                *out++ = ':';
+                out = write_pair(out, seconds / 60 % 60);
+                *out++ = ':';
+                out = write_pair(out, seconds % 60);
+            }
+
+            field += static_cast<std::ptrdiff_t>(fixed_fields_);
+        }
+
+        for (; field != fields_.end(); ++field) {
+            out = write_field(*field, value, date, seconds, out);
+        }
+
+        return out;
+    }
+
+   private:
+    friend class internal::ColumnFormatter;
+    friend class internal::FormatCache;
+
+    // Writes a field of a value, whose local date and seconds of the day are given
+    char* write_field(const internal::FormatField& field, const internal::FormatValue& value,
+                      const internal::CivilDay& date, std::uint64_t seconds, char* out) const {
+        using namespace internal;
+
+        switch (field.op) {
+            case FormatOp::kLiteral:
+                // Separators are mostly single characters, not worth a call to memcpy()
+                if (field.size == 1) {
+                    *out++ = literals_[field.begin];
+                } else {
+                    std::memcpy(out, literals_.data() + field.begin, field.size);
+                    out += field.size;
+                }
+
+                break;
+            case FormatOp::kYear:
+                out = write_integer(out, date.year);
+                break;
+            case FormatOp::kShortYear: {
+                const auto year = (date.year % 100 + 100) % 100;
+                out = write_pair(out, static_cast<std::uint64_t>(year));
+                break;
+            }
+            case FormatOp::kMonth:
+                out = write_pair(out, static_cast<std::uint64_t>(date.month));
+                break;
+            case FormatOp::kDay:
+                out = write_pair(out, static_cast<std::uint64_t>(date.day));
+                break;
+            case FormatOp::kSpacedDay:
+                *out++ = date.day < 10 ? ' ' : static_cast<char>('0' + date.day / 10);
+                *out++ = static_cast<char>('0' + date.day % 10);
+                break;
+            case FormatOp::kDayOfYear: {
+                const auto yday = day_of_year(date.year, date.month, date.day);
+                out = write_digits(out, static_cast<std::uint64_t>(yday), 3);
+                break;
+            }
+            case FormatOp::kHour:
+                out = write_pair(out, seconds / 3600);
+                break;
+            case FormatOp::kMinute:
+                out = write_pair(out, seconds / 60 % 60);
+                break;
+            case FormatOp::kSecond:
+                out = write_pair(out, seconds % 60);
+                break;
+            case FormatOp::kFraction:
+                out = write_fraction(out, value.nanos, field.width, field.dot);
+                break;
+            case FormatOp::kOffset:
+                out = write_offset(out, value.offset, field.width);
+                break;
+        }
+
+        return out;
+    }
+
+    // Values of common patterns are written on the stack before they are copied
+    static constexpr std::size_t kBufferSize = 128;
+
+    // Fields of YYYY-MM-DD, and of YYYY-MM-DDThh:mm:ss with a 'T' or a space
+    static constexpr std::size_t kFixedDateFields = 5;
+    static constexpr std::size_t kFixedDateTimeFields = 11;
+
+    void add(internal::FormatOp op, std::uint8_t width = 0, bool dot = false) {
+        fields_.push_back(internal::FormatField{op, width, dot, 0, 0});
+    }
+
+    // Text next to the previous literal extends it
+    void add_literal(const char* text, std::size_t size) {
+        if (size == 0) {
+            return;
+        }
+
+        if (fields_.empty() || fields_.back().op != internal::FormatOp::kLiteral) {
+            const auto begin = static_cast<std::uint32_t>(literals_.size());
+            fields_.push_back(
+                    internal::FormatField{internal::FormatOp::kLiteral, 0, false, begin, 0});
+        }
+
+        literals_.append(text, size);
+        fields_.back().size += static_cast<std::uint32_t>(size);
+    }
+
+    // Compiles the specifier at i, past a '%', and returns the index past it, or 0 if the
+    // specifier has no field
+    std::size_t compile_specifier(std::size_t i) {
+        using internal::FormatOp;
+
+        const auto at = [this](std::size_t j) { return j < pattern_.size() ? pattern_[j] : '\0'; };
+
+        switch (at(i)) {
+            case 'Y':
+                add(FormatOp::kYear);
+                return i + 1;
+            case 'y':
+                add(FormatOp::kShortYear);
+                return i + 1;
+            case 'm':
+                add(FormatOp::kMonth);
+                return i + 1;
+            case 'd':
+                add(FormatOp::kDay);
+                return i + 1;
+            case 'e':
+                add(FormatOp::kSpacedDay);
+                return i + 1;
+            case 'j':
+                add(FormatOp::kDayOfYear);
+                return i + 1;
+            case 'H':
+                add(FormatOp::kHour);
+                return i + 1;
+            case 'M':
+                add(FormatOp::kMinute);
+                return i + 1;
+            case 'S':
+                add(FormatOp::kSecond);
+                return i + 1;
+            case 'z':
+                add(FormatOp::kOffset, internal::kHoursMinutes);
+                return i + 1;
+            case '%':
+                add_literal("%", 1);
+                return i + 1;
+            case 'F':
+                add(FormatOp::kYear);
+                add_literal("-", 1);
+                add(FormatOp::kMonth);
+                add_literal("-", 1);
+                add(FormatOp::kDay);
+                return i + 1;
+            case 'T':
+            case 'R':
+                add(FormatOp::kHour);
+                add_literal(":", 1);
+                add(FormatOp::kMinute);
+
+                if (at(i) == 'T') {
+                    add_literal(":", 1);
+                    add(FormatOp::kSecond);
+                }
+
+                return i + 1;
+            case 'E':
+                return compile_extension(i + 1);
+            default:
+                return 0;
+        }
+    }
+
+    // Specifiers after %E: %Ez, %E*z, %E*S, %E*f, and %E#S and %E#f up to nanoseconds
+    std::size_t compile_extension(std::size_t i) {
+        using internal::FormatOp;
+
+        const auto at = [this](std::size_t j) { return j < pattern_.size() ? pattern_[j] : '\0'; };
+
+        if (at(i) == 'z') {
+            add(FormatOp::kOffset, internal::kHoursColonMinutes);
+            return i + 1;
+        }
+
+        std::uint8_t width = internal::kAllDigits;
+
+        if (at(i) == '*') {
+            ++i;
+
+            if (at(i) == 'z') {
+                add(FormatOp::kOffset, internal::kHoursColonMinutesSeconds);
+                return i + 1;
+            }
+        } else if (at(i) >= '0' && at(i) <= '9' && !(at(i + 1) >= '0' && at(i + 1) <= '9')) {
+            width = static_cast<std::uint8_t>(at(i++) - '0');
+        } else {
+            return 0;
+        }
+
+        if (at(i) == 'S') {
+            add(FormatOp::kSecond);
+            add(FormatOp::kFraction, width, true);
+            return i + 1;
+        }
+
+        if (at(i) == 'f') {
+            add(FormatOp::kFraction, width, false);
+            return i + 1;
+        }
+
+        return 0;
+    }
+
+    void compile() {
+        using internal::FormatOp;
+
+        static std::atomic<std::uint64_t> ids(0);
+        id_ = ++ids;
+        ymd_ = pattern_ == "%Y%m%d";
+        formats_natively_ = true;
+
+        for (std::size_t i = 0; i < pattern_.size();) {
+            const auto percent = pattern_.find('%', i);
+
+            if (percent == std::string::npos) {
+                add_literal(pattern_.data() + i, pattern_.size() - i);
+                break;
+            }
+
+            add_literal(pattern_.data() + i, percent - i);
+            i = compile_specifier(percent + 1);
+
+            if (i == 0) {
+                formats_natively_ = false;
+                break;
+            }
+        }
+
+        if (!formats_natively_) {
+            fields_.clear();
+            literals_.clear();
+            return;
+        }
+
+        // Parsing takes the fields of the ISO 8601 layouts, and %E*S which ignores the fraction
+        parses_natively_ = !ymd_;
+
+        for (const auto& field : fields_) {
+            switch (field.op) {
+                case FormatOp::kLiteral:
+                    max_size_ += field.size;
+                    break;
+                case FormatOp::kYear:
+                    max_size_ += 20;
+                    break;
+                case FormatOp::kDayOfYear:
+                    max_size_ += 3;
+                    parses_natively_ = false;
+                    break;
+                case FormatOp::kShortYear:
+                case FormatOp::kSpacedDay:
+                    max_size_ += 2;
+                    parses_natively_ = false;
+                    break;
+                case FormatOp::kFraction:
+                    max_size_ += (field.dot ? 1 : 0) +
+                                 (field.width == internal::kAllDigits ? 9 : field.width);
+                    parses_natively_ &= field.dot && field.width == internal::kAllDigits;
+                    break;
+                case FormatOp::kOffset:
+                    max_size_ += field.width == internal::kHoursMinutes ? 5 : 6;
+                    max_size_ += field.width == internal::kHoursColonMinutesSeconds ? 3 : 0;
+                    parses_natively_ &= field.width != internal::kHoursColonMinutesSeconds;
+                    break;
+                default:
+                    max_size_ += 2;
+                    break;
+            }
+        }
+
+        const auto is = [this](std::size_t i, FormatOp op) {
+            return i < fields_.size() && fields_[i].op == op;
+        };
+
+        const auto is_char = [this, &is](std::size_t i, char c) {
+            return is(i, FormatOp::kLiteral) && fields_[i].size == 1 &&
+                   literals_[fields_[i].begin] == c;
+        };
+
+        if (is(0, FormatOp::kYear) && is_char(1, '-') && is(2, FormatOp::kMonth) &&
+            is_char(3, '-') && is(4, FormatOp::kDay)) {
+            fixed_fields_ = kFixedDateFields;
+
+            if ((is_char(5, 'T') || is_char(5, ' ')) && is(6, FormatOp::kHour) &&
+                is_char(7, ':') && is(8, FormatOp::kMinute) && is_char(9, ':') &&
+                is(10, FormatOp::kSecond)) {
+                fixed_fields_ = kFixedDateTimeFields;
+            }
+        }
+    }
+
+    std::string pattern_;
+    std::string literals_;
+    std::vector<internal::FormatField> fields_;
+    std::size_t max_size_ = 0;
+    bool formats_natively_ = false;
+    bool parses_natively_ = false;
+    bool ymd_ = false;
+    std::size_t fixed_fields_ = 0;
+    // Identity of the compiled fields, shared by copies
+    std::uint64_t id_ = 0;
+};
+
+namespace internal {
+
+// Last value written with a Format. The next value on the same local day and at the same offset
+// only rewrites the time fields whose unit changed, and moves what follows them if their width
+// changed, as a fraction of %E*S may.
+class FormatCache {
+   public:
+    static constexpr std::size_t kCapacity = 128;
+
+    static bool accepts(const Format& format) {
+        return format.formats_natively() && format.max_size() <= kCapacity;
+    }
+
+    bool holds(const Format& format) const { return id_ == format.id_; }
+
+    // Characters of the value, valid until the next call
+    string_view write(const Format& format, const FormatValue& value) {
+        const auto local = value.instant + value.offset;
+        const auto day = floor_div(local, kSecondsPerDay);
+        const auto seconds = static_cast<std::uint64_t>(local - day * kSecondsPerDay);
+
+        if (id_ != format.id_ || day != day_ || value.offset != offset_) {
+            render(format, value, day, seconds);
+        } else if (seconds != seconds_ || value.nanos != nanos_) {
+            patch(format, value, seconds);
+        }
+
+        return string_view(buffer_, size_);
+    }
+
+   private:
+    void render(const Format& format, const FormatValue& value, std::int64_t day,
+                std::uint64_t seconds) {
+        id_ = format.id_;
+        day_ = day;
+        date_ = civil_from_days(day);
+        offset_ = value.offset;
+        seconds_ = seconds;
+        nanos_ = value.nanos;
+
+        char* out = buffer_;
+        positions_.clear();
+        time_fields_.clear();
+
+        for (const auto& field : format.fields_) {
+            if (is_time_of_day(field.op)) {
+                time_fields_.push_back(static_cast<std::uint32_t>(positions_.size()));
+            }
+
+            positions_.push_back(static_cast<std::uint32_t>(out - buffer_));
+            out = format.write_field(field, value, date_, seconds, out);
+        }
+
+        size_ = static_cast<std::uint32_t>(out - buffer_);
+        positions_.push_back(size_);
+    }
+
+    void patch(const Format& format, const FormatValue& value, std::uint64_t seconds) {
+        const auto& fields = format.fields_;
+
+        for (const auto i : time_fields_) {
+            if (!changed(fields[i].op, seconds, value.nanos)) {
+                continue;
+            }
+
+            char text[16];
+            const auto size = static_cast<std::uint32_t>(
+                    format.write_field(fields[i], value, date_, seconds, text) - text);
+            const auto begin = positions_[i];
+            const auto end = positions_[i + 1];
+
+            if (size != end - begin) {
+                std::memmove(buffer_ + begin + size, buffer_ + end, size_ - end);
+
+                for (auto j = i + 1; j < positions_.size(); ++j) {
+                    positions_[j] = positions_[j] - (end - begin) + size;
+                }
+
+                size_ = positions_.back();
+            }
+
+            std::memcpy(buffer_ + begin, text, size);
+        }
+
+        seconds_ = seconds;
+        nanos_ = value.nanos;
+    }
+
+    bool changed(FormatOp op, std::uint64_t seconds, std::int32_t nanos) const {
+        switch (op) {
+            case FormatOp::kHour:
+                return seconds / kSecondsPerHour != seconds_ / kSecondsPerHour;
+            case FormatOp::kMinute:
+                return seconds / kSecondsPerMinute != seconds_ / kSecondsPerMinute;
+            case FormatOp::kSecond:
+                return seconds != seconds_;
+            case FormatOp::kFraction:
+                return nanos != nanos_;
+            default:
+                return false;
+        }
+    }
+
+    // Formats are numbered from 1
+    std::uint64_t id_ = 0;
+    std::int64_t day_ = 0;
+    CivilDay date_{1970, 1, 1};
+    std::int32_t offset_ = 0;
+    std::uint64_t seconds_ = 0;
+    std::int32_t nanos_ = 0;
+
+    char buffer_[kCapacity];
+    std::uint32_t size_ = 0;
+    // Start of each field in buffer_, and the end of the last one
+    std::vector<std::uint32_t> positions_;
+    // Fields rewritten on a hit
+    std::vector<std::uint32_t> time_fields_;
+};
+
+// Caches of the Formats written last on the thread
+inline FormatCache& thread_format_cache(const Format& format) {
+    constexpr std::size_t kCaches = 4;
+
+    thread_local FormatCache caches[kCaches];
+    thread_local std::size_t next = 0;
+
+    for (auto& cache : caches) {
+        if (cache.holds(format)) {
+            return cache;
+        }
+    }
+
+    auto& cache = caches[next];
+    next = (next + 1) % kCaches;
+
+    return cache;
+}
+
+// Same as Format::format_to(), through the cache of the thread
+inline std::size_t format_to_cached(const Format& format, const FormatValue& value, char* out,
+                                    std::size_t size) {
+    if (!FormatCache::accepts(format)) {
+        return format.format_to(value, out, size);
+    }
+
+    const auto formatted = thread_format_cache(format).write(format, value);
+    std::memcpy(out, formatted.data(), formatted.size() < size ? formatted.size() : size);
+
+    return formatted.size();
+}
+
+// Streams a value without a temporary string, unless the stream pads it to a width
+template <typename T>
+std::ostream& write_formatted(std::ostream& out, const T& value, const Format& format) {
+    char buffer[128];
+
+    if (out.width() != 0 || !format.formats_natively() || format.max_size() > sizeof(buffer)) {
+        return out << value.format(format);
+    }
+
+    const auto size = value.format_to(buffer, sizeof(buffer), format);
+    return out.write(buffer, static_cast<std::streamsize>(size));
+}
+
+// Patterns compiled last on the thread, for the overloads which take a pattern as a string
+inline const Format& cached_format(string_view pattern) {
+    constexpr std::size_t kCachedFormats = 4;
+
+    thread_local Format formats[kCachedFormats];
+    thread_local std::size_t next = 0;
+
+    for (const auto& format : formats) {
+        if (string_view(format.pattern()) == pattern) {
+            return format;
+        }
+    }
+
+    auto& format = formats[next];
+    next = (next + 1) % kCachedFormats;
+    format = Format(pattern);
+
+    return format;
+}
+
+}  // namespace internal
+
+}  // namespace pendulum
+
+// Format compiled once, on first use, for a pattern known at compile time
+#define PENDULUM_FORMAT(pattern)                          \
+    ([]() -> const ::pendulum::Format& {                  \
+        static const ::pendulum::Format format(pattern);  \
+        return format;                                    \
+    }())
+
+#endif  // PENDULUM_FORMAT_H_
@@ -27,9 +27,11 @@
 #include <ctime>
 #include <string>
 
+#include "pendulum/clock.h"
 #include "pendulum/constants.h"
 #include "pendulum/date.h"
 #include "pendulum/datetime.h"
+#include "pendulum/exceptions.h"
 #include "pendulum/period.h"
 #include "pendulum/testing.h"
 
@@ -37,40 +39,97 @@ namespace pendulum {
 
 inline Date date(int y, int m, int d) { return Date(y, m, d); }
 
-inline DateTime datetime(int y, int m, int d, const std::string& tz = "UTC") {
+inline DateTime datetime(int y, int m, int d, internal::string_view tz = "UTC") {
     return DateTime(y, m, d, tz);
 }
 
 inline DateTime datetime(int y, int m, int d, int hh, int mm = 0, int ss = 0,
-                         const std::string& tz = "UTC") {
+                         internal::string_view tz = "UTC") {
     return DateTime(y, m, d, hh, mm, ss, tz);
 }
 
+inline Expected<Date> try_date(int y, int m, int d) { return Date::create(y, m, d); }
+
+inline Expected<DateTime> try_datetime(int y, int m, int d, int hh = 0, int mm = 0, int ss = 0,
+                                       internal::string_view tz = "UTC") {
+    return DateTime::create(y, m, d, hh, mm, ss, tz);
+}
+
 inline DateTime local(int y, int m, int d, int hh = 0, int mm = 0, int ss = 0) {
     return datetime(y, m, d, hh, mm, ss, "local");
 }
 
-inline DateTime now(const std::string& tz = "local") {
-    if (has_test_now()) {
-        return get_test_now();
+inline DateTime from_timestamp(time_t timestamp, internal::string_view tz = "UTC") {
+    return DateTime::from_instant(timestamp, internal::zone_id(tz));
+}
+
+template <typename Duration>
+inline DateTime from_time_point(
+        const std::chrono::time_point<std::chrono::system_clock, Duration>& tp,
+        internal::string_view tz = "UTC") {
+    return DateTime::from_time_point(tp, tz);
+}
+
+template <typename Clock>
+inline DateTime now(internal::string_view tz = "local") {
+    return internal::NowCache::instance().now(internal::to_timestamp(Clock::now()), tz);
+}
+
+template <typename Clock>
+inline DateTime today(internal::string_view tz = "local") {
+    return internal::NowCache::instance().day(internal::to_timestamp(Clock::now()).seconds, tz, 0);
+}
+
+template <typename Clock>
+inline DateTime yesterday(internal::string_view tz = "local") {
+    return internal::NowCache::instance().day(internal::to_timestamp(Clock::now()).seconds, tz, -1);
+}
+
+template <typename Clock>
+inline DateTime tomorrow(internal::string_view tz = "local") {
+    return internal::NowCache::instance().day(internal::to_timestamp(Clock::now()).seconds, tz, 1);
+}
+
+inline DateTime now(internal::string_view tz = "local") {
+    if (auto* clock = internal::current_clock()) {
+        return clock->now(tz);
     }
 
-    const auto& timezone = internal::timezone(tz);
-    const auto& cs = cctz::convert(std::chrono::system_clock::now(), timezone);
+    return now<SystemClock>(tz);
+}
 
-    return DateTime(cs, timezone);
+inline DateTime today(internal::string_view tz = "local") {
+    if (auto* clock = internal::current_clock()) {
+        return clock->day(tz, 0);
+    }
+
+    return today<SystemClock>(tz);
 }
 
-inline DateTime today(const std::string& tz = "local") { return now(tz).start_of("day"); }
-inline DateTime yesterday(const std::string& tz = "local") { return today(tz).add_days(-1); }
-inline DateTime tomorrow(const std::string& tz = "local") { return today(tz).add_days(1); }
+inline DateTime yesterday(internal::string_view tz = "local") {
+    if (auto* clock = internal::current_clock()) {
+        return clock->day(tz, -1);
+    }
 
-inline DateTime from_timestamp(time_t timestamp, const std::string& tz = "UTC") {
-    const auto& timezone = internal::timezone(tz);
-    const auto& tp = std::chrono::system_clock::from_time_t(timestamp);
-    const auto& cs = cctz::convert(tp, timezone);
+    return yesterday<SystemClock>(tz);
+}
+
+inline DateTime tomorrow(internal::string_view tz = "local") {
+    if (auto* clock = internal::current_clock()) {
+        return clock->day(tz, 1);
+    }
+
+    return tomorrow<SystemClock>(tz);
+}
+
+// Same as now() but read from the coarse clock, which is several times cheaper and only as
+// precise as the tick of the kernel (a few milliseconds)
+inline DateTime fast_now(internal::string_view tz = "local") {
+    if (auto* clock = internal::current_clock()) {
+        return clock->now(tz);
+    }
 
-    return DateTime(cs, timezone);
+    return now<CoarseClock>(tz);
 }
 
 inline DateTime from_localtime(const std::tm& tm) {
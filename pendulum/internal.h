@@ -23,14 +23,40 @@
 #ifndef PENDULUM_INTERNAL_H_
 #define PENDULUM_INTERNAL_H_
 
+#include <cstddef>
+#include <cstdint>
+
+#include <nonstd/string_view.hpp>
 #include <tl/optional.hpp>
 
 namespace pendulum {
 namespace internal {
 
+using nonstd::string_view;
 using tl::nullopt;
 using tl::optional;
 
+// Finalizer of MurmurHash3, which is invertible and spreads every bit of the value
+inline std::uint64_t hash_mix(std::uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+
+    return value;
+}
+
+inline std::size_t hash_combine(std::size_t seed, std::size_t value) {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+// Hash of a UTC instant, shared by every type which compares by instant
+inline std::size_t hash_instant(std::int64_t seconds, std::int32_t nanos = 0) {
+    const auto hash = static_cast<std::size_t>(hash_mix(static_cast<std::uint64_t>(seconds)));
+    return nanos == 0 ? hash : hash_combine(hash, static_cast<std::size_t>(nanos));
+}
+
 }  // namespace internal
 }  // namespace pendulum
 
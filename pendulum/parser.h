@@ -25,105 +25,927 @@
 
 #include <algorithm>
 #include <chrono>
-#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <vector>
 
 #include <cctz/time_zone.h>
 
+#include "pendulum/batch.h"
+#include "pendulum/calendar.h"
+#include "pendulum/constants.h"
 #include "pendulum/datetime.h"
 #include "pendulum/exceptions.h"
+#include "pendulum/format.h"
 #include "pendulum/helpers.h"
+#include "pendulum/simd.h"
+#include "pendulum/transitions.h"
 
 namespace pendulum {
 
 namespace internal {
 
-inline bool is_digit(const std::string& input) {
-    return std::all_of(input.begin(), input.end(), [](unsigned char c) { return std::isdigit(c); });
+inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+inline bool is_space(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+inline Expected<DateTime> try_from_ymd(string_view input, ZoneId zone) {
+    const auto error = [input] { return Error(kUnsupportedFormat, "input: ", input, "%Y%m%d"); };
+
+    if (input.size() < 5 ||
+        !std::all_of(input.begin(), input.end(), [](char c) { return is_digit(c); })) {
+        return error();
+    }
+
+    // The year takes every digit but the last four and must fit in an int
+    const auto year_digits = input.size() - 4;
+    std::int64_t year = 0;
+
+    for (std::size_t i = 0; i < year_digits; ++i) {
+        year = year * 10 + (input[i] - '0');
+
+        if (year > std::numeric_limits<int>::max()) {
+            return error();
+        }
+    }
+
+    const auto month = (input[year_digits] - '0') * 10 + (input[year_digits + 1] - '0');
+    const auto day = (input[year_digits + 2] - '0') * 10 + (input[year_digits + 3] - '0');
+    const cctz::civil_second cs(year, month, day);
+
+    // input must be normalized before creating a DateTime instance
+    if (cs.year() != year || cs.month() != month || cs.day() != day) {
+        return error();
+    }
+
+    return DateTime(cs, zone);
+}
+
+// Reads the two digits at p, within [min, max]
+inline bool parse_pair(const char*& p, const char* end, int min, int max, int* value) {
+    if (end - p < 2 || !is_digit(p[0]) || !is_digit(p[1])) {
+        return false;
+    }
+
+    *value = (p[0] - '0') * 10 + (p[1] - '0');
+    p += 2;
+
+    return *value >= min && *value <= max;
+}
+
+// Parses the canonical widths of a native pattern: years of four digits, other numbers of two and
+// offsets of hours and minutes. Anything else, which cctz::parse() may still take, is rejected.
+inline bool parse_format(string_view input, const Format& format, ZoneId zone,
+                         std::int64_t* instant, std::int32_t* nanos) {
+    const char* p = input.data();
+    const char* end = p + input.size();
+
+    // Fields left out default to 1970-01-01T00:00:00, as in cctz::parse()
+    int year = 1970;
+    int month = 1;
+    int day = 1;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    int offset = 0;
+    bool has_offset = false;
+    std::int32_t fraction = 0;
+
+    const auto skip_spaces = [&p, end] {
+        while (p != end && is_space(*p)) {
+            ++p;
+        }
+    };
+
+    skip_spaces();
+
+    for (const auto& field : format.fields()) {
+        switch (field.op) {
+            case FormatOp::kLiteral:
+                // Whitespace matches any run of whitespace
+                for (const auto c : format.literal(field)) {
+                    if (is_space(c)) {
+                        skip_spaces();
+                    } else if (p == end || *p++ != c) {
+                        return false;
+                    }
+                }
+
+                break;
+            case FormatOp::kYear:
+                if (end - p < 4 || !std::all_of(p, p + 4, is_digit) ||
+                    (end - p > 4 && is_digit(p[4]))) {
+                    return false;
+                }
+
+                year = (p[0] - '0') * 1000 + (p[1] - '0') * 100 + (p[2] - '0') * 10 + (p[3] - '0');
+                p += 4;
+                break;
+            case FormatOp::kMonth:
+                if (!parse_pair(p, end, 1, 12, &month)) {
+                    return false;
+                }
+
+                break;
+            case FormatOp::kDay:
+                if (!parse_pair(p, end, 1, 31, &day)) {
+                    return false;
+                }
+
+                break;
+            case FormatOp::kHour:
+                if (!parse_pair(p, end, 0, 23, &hour)) {
+                    return false;
+                }
+
+                break;
+            case FormatOp::kMinute:
+                if (!parse_pair(p, end, 0, 59, &minute)) {
+                    return false;
+                }
+
+                break;
+            case FormatOp::kSecond:
+                // Leap seconds are left to cctz
+                if (!parse_pair(p, end, 0, 59, &second)) {
+                    return false;
+                }
+
+                break;
+            case FormatOp::kFraction:
+                // Digits past nanoseconds are read but dropped
+                if (p != end && *p == '.') {
+                    if (++p == end || !is_digit(*p)) {
+                        return false;
+                    }
+
+                    const auto* digits = p;
+                    p = std::find_if(p, end, [](char c) { return !is_digit(c); });
+
+                    const auto size = std::min<std::ptrdiff_t>(p - digits, 9);
+
+                    for (std::ptrdiff_t i = 0; i < size; ++i) {
+                        fraction = fraction * 10 + (digits[i] - '0');
+                    }
+
+                    fraction *= kPowersOf10[9 - size];
+                }
+
+                break;
+            case FormatOp::kOffset: {
+                if (p == end || (*p != '+' && *p != '-')) {
+                    return false;
+                }
+
+                const auto sign = *p++ == '-' ? -1 : 1;
+                int hours = 0;
+                int minutes = 0;
+
+                if (!parse_pair(p, end, 0, 23, &hours) ||
+                    (field.width == kHoursColonMinutes && (p == end || *p++ != ':')) ||
+                    !parse_pair(p, end, 0, 59, &minutes)) {
+                    return false;
+                }
+
+                offset = sign * (hours * kSecondsPerHour + minutes * kSecondsPerMinute);
+                has_offset = true;
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    skip_spaces();
+
+    if (p != end || day > days_in_month(year, month)) {
+        return false;
+    }
+
+    const auto local = days_from_civil(year, month, day) * kSecondsPerDay +
+                       hour * kSecondsPerHour + minute * kSecondsPerMinute + second;
+
+    // Skipped local times resolve with the offset before the transition, as in cctz::parse()
+    *instant = has_offset ? local - offset : internal::zone(zone).table.to_instant_pre(local);
+    *nanos = fraction;
+    return true;
 }
 
-inline DateTime from_ymd(const std::string& input, const std::string& tz = "UTC") {
-    if (input.size() < 5) {
-        throw UnsupportedFormat("input: " + input + " - format: %Y%m%d");
+inline Expected<DateTime> try_from_format(string_view input, const Format& format, ZoneId zone) {
+    if (format.is_ymd()) {
+        return try_from_ymd(input, zone);
+    }
+
+    std::int64_t instant = 0;
+    std::int32_t nanos = 0;
+
+    if (format.parses_natively() && parse_format(input, format, zone, &instant, &nanos)) {
+        return DateTime::from_instant(instant, zone, nanos);
     }
 
-    if (!is_digit(input)) {
-        throw UnsupportedFormat("input: " + input + " - format: %Y%m%d");
+    // cctz::parse() takes strings, whose buffer is reused by the calls of the thread
+    thread_local std::string input_buffer;
+    input_buffer.assign(input.data(), input.size());
+
+    cctz::time_point<cctz::seconds> tp;
+    cctz::detail::femtoseconds fs;
+
+    if (!cctz::detail::parse(format.pattern(), input_buffer, timezone(zone), &tp, &fs)) {
+        return Error(kUnsupportedFormat, "input: ", input, format.pattern());
     }
 
-    int year = 0, month = 0, day = 0;
+    return DateTime::from_instant(tp.time_since_epoch().count(), zone,
+                                  static_cast<std::int32_t>(fs.count() / 1000000));
+}
+
+inline Expected<DateTime> try_from_format(string_view input, string_view fmt, ZoneId zone) {
+    return try_from_format(input, cached_format(fmt), zone);
+}
 
-    try {
-        year = std::stoi(input.substr(0, input.size() - 4));
-        month = std::stoi(input.substr(input.size() - 4, 2));
-        day = std::stoi(input.substr(input.size() - 2, 2));
-    } catch (const std::invalid_argument& e) {
-        throw UnsupportedFormat("input: " + input + " - format: %Y%m%d - " + e.what());
-    } catch (const std::out_of_range& e) {
-        throw UnsupportedFormat("input: " + input + " - format: %Y%m%d - " + e.what());
+// Fields of an ISO 8601 / RFC 3339 date time, in the order they appear
+enum Iso8601Field {
+    kYearField,
+    kMonthField,
+    kDayField,
+    kHourField,
+    kMinuteField,
+    kSecondField,
+    kFractionField,
+    kOffsetHourField,
+    kOffsetMinuteField,
+    kOffsetSecondField,
+    kIso8601Fields,
+};
+
+struct Iso8601 {
+    std::int64_t year = 0;
+    int month = 1;
+    int day = 1;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    std::int32_t nanos = 0;
+    bool has_offset = false;
+    std::int32_t offset = 0;
+
+    // Position and number of characters of each field in the input, kept for Iso8601Layout
+    std::uint8_t starts[kIso8601Fields] = {};
+    std::uint8_t widths[kIso8601Fields] = {};
+};
+
+// Reads one or two digits within [min, max], as cctz::parse() does for %m, %d, %H, %M and %S
+inline const char* scan_field(const char* p, const char* end, int min, int max, int* value) {
+    if (p == end || !is_digit(*p)) {
+        return nullptr;
     }
 
-    DateTime dt(year, month, day, tz);
+    int v = *p++ - '0';
 
-    // input must be normalized before creating a DateTime instance
-    if (dt.year() != year || dt.month() != month || dt.day() != day) {
-        throw UnsupportedFormat("input: " + input + " - format: %Y%m%d");
+    if (p != end && is_digit(*p)) {
+        v = v * 10 + (*p++ - '0');
+    }
+
+    if (v < min || v > max) {
+        return nullptr;
+    }
+
+    *value = v;
+    return p;
+}
+
+// Reads exactly two digits within [0, max]
+inline const char* scan_pair(const char* p, const char* end, int max, int* value) {
+    if (end - p < 2 || !is_digit(p[0]) || !is_digit(p[1])) {
+        return nullptr;
+    }
+
+    const auto v = (p[0] - '0') * 10 + (p[1] - '0');
+
+    if (v > max) {
+        return nullptr;
+    }
+
+    *value = v;
+    return p + 2;
+}
+
+// Reads four characters of year as %E4Y does, i.e. 0000 to 9999 or -999 to -001
+inline const char* scan_year(const char* p, const char* end, std::int64_t* year) {
+    if (end - p < 4) {
+        return nullptr;
+    }
+
+    const auto negative = *p == '-';
+    std::int64_t v = 0;
+
+    for (auto q = p + (negative ? 1 : 0); q != p + 4; ++q) {
+        if (!is_digit(*q)) {
+            return nullptr;
+        }
+
+        v = v * 10 + (*q - '0');
+    }
+
+    if (negative && v == 0) {
+        return nullptr;
+    }
+
+    *year = negative ? -v : v;
+    return p + 4;
+}
+
+// Reads the digits after the decimal mark, keeping nanoseconds
+inline const char* scan_fraction(const char* p, const char* end, std::int32_t* nanos) {
+    if (p == end || !is_digit(*p)) {
+        return nullptr;
+    }
+
+    std::int32_t v = 0;
+    std::int32_t scale = kNanosecondsPerSecond;
+
+    for (; p != end && is_digit(*p); ++p) {
+        if (scale > 1) {
+            scale /= 10;
+            v += (*p - '0') * scale;
+        }
+    }
+
+    *nanos = v;
+    return p;
+}
+
+// Recognizes the date time in a single pass:
+//   YYYY, YYYY-MM, YYYY-MM-DD and YYYYMMDD
+//   YYYY-MM-DD[T ]hh:mm:ss and YYYYMMDDThhmmss followed by optional .fraction and Z/+hh:mm
+// Leading and trailing whitespace is ignored and fields may have a single digit, as in
+// cctz::parse().
+class Iso8601Scanner {
+   public:
+    Iso8601Scanner(string_view input, Iso8601* out)
+            : begin_(input.data()), end_(begin_ + input.size()), out_(out) {}
+
+    bool scan() {
+        const char* p = begin_;
+
+        while (p != end_ && is_space(*p)) {
+            ++p;
+        }
+
+        while (p != end_ && is_space(*(end_ - 1))) {
+            --end_;
+        }
+
+        p = mark(kYearField, p, scan_year(p, end_, &out_->year));
+
+        if (p == nullptr || p == end_) {
+            return p != nullptr;
+        }
+
+        const auto extended = *p == '-';
+
+        if (extended) {
+            p = field(kMonthField, p + 1, 1, 12, &out_->month);
+
+            if (p == nullptr || p == end_) {
+                return p != nullptr;
+            }
+
+            p = *p == '-' ? field(kDayField, p + 1, 1, 31, &out_->day) : nullptr;
+        } else {
+            p = field(kMonthField, p, 1, 12, &out_->month);
+            p = p ? field(kDayField, p, 1, 31, &out_->day) : nullptr;
+        }
+
+        if (p == nullptr || out_->day > days_in_month(out_->year, out_->month)) {
+            return false;
+        }
+
+        if (p == end_) {
+            return true;
+        }
+
+        if (*p != 'T' && *p != 't' && (!extended || *p != ' ')) {
+            return false;
+        }
+
+        const auto separator = extended ? ':' : '\0';
+
+        p = field(kHourField, p + 1, 0, 23, &out_->hour);
+        p = p ? field(kMinuteField, skip(p, separator), 0, 59, &out_->minute) : nullptr;
+        p = p ? field(kSecondField, skip(p, separator), 0, 60, &out_->second) : nullptr;
+
+        if (p != nullptr && p != end_ && (*p == '.' || *p == ',')) {
+            p = mark(kFractionField, p + 1, scan_fraction(p + 1, end_, &out_->nanos));
+        }
+
+        if (p != nullptr && p != end_) {
+            out_->has_offset = true;
+            p = offset(p);
+        }
+
+        return p == end_;
+    }
+
+   private:
+    const char* mark(Iso8601Field field, const char* from, const char* to) {
+        if (to != nullptr) {
+            out_->starts[field] = static_cast<std::uint8_t>(from - begin_);
+            out_->widths[field] = static_cast<std::uint8_t>(to - from);
+        }
+
+        return to;
+    }
+
+    const char* field(Iso8601Field field, const char* p, int min, int max, int* value) {
+        return mark(field, p, scan_field(p, end_, min, max, value));
+    }
+
+    // Skips the separator, which is required when there is one
+    const char* skip(const char* p, char separator) const {
+        if (separator == '\0') {
+            return p;
+        }
+
+        return p != end_ && *p == separator ? p + 1 : end_;
+    }
+
+    // Reads Z or +hh, +hhmm, +hh:mm, +hhmmss and +hh:mm:ss as %Ez does
+    const char* offset(const char* p) {
+        if (*p == 'Z' || *p == 'z') {
+            out_->offset = 0;
+            return p + 1;
+        }
+
+        if (*p != '+' && *p != '-') {
+            return nullptr;
+        }
+
+        const auto sign = *p++ == '-' ? -1 : 1;
+        int hours = 0;
+        int minutes = 0;
+        int seconds = 0;
+
+        p = mark(kOffsetHourField, p, scan_pair(p, end_, 23, &hours));
+
+        if (p != nullptr && p != end_ && (*p == ':' || is_digit(*p))) {
+            p = *p == ':' ? p + 1 : p;
+            p = mark(kOffsetMinuteField, p, scan_pair(p, end_, 59, &minutes));
+        }
+
+        if (p != nullptr && p != end_ && (*p == ':' || is_digit(*p))) {
+            p = *p == ':' ? p + 1 : p;
+            p = mark(kOffsetSecondField, p, scan_pair(p, end_, 59, &seconds));
+        }
+
+        out_->offset = sign * ((hours * 60 + minutes) * 60 + seconds);
+        return p;
+    }
+
+    const char* begin_;
+    const char* end_;
+    Iso8601* out_;
+};
+
+inline bool scan_iso8601(string_view input, Iso8601* out) {
+    return Iso8601Scanner(input, out).scan();
+}
+
+// Non-digit characters of a row which scanned, and where its fields are. Rows of the same shape,
+// as the rows of a column usually are, then decode at fixed positions without scanning.
+class Iso8601Layout {
+   public:
+    static constexpr std::size_t kWords = 8;
+    static constexpr std::size_t kMaxSize = kWords * sizeof(std::uint64_t);
+
+    void compile(string_view row, const Iso8601& fields) {
+        size_ = 0;
+
+        if (row.size() > kMaxSize) {
+            return;
+        }
+
+        // Bytes past the row are literal zeros, which the zero padding of decode() matches
+        char digits[kMaxSize] = {};
+        char literals[kMaxSize] = {};
+
+        for (std::size_t i = 0; i < row.size(); ++i) {
+            (is_digit(row[i]) ? digits[i] : literals[i]) = is_digit(row[i]) ? '\xff' : row[i];
+        }
+
+        std::memcpy(digits_, digits, kMaxSize);
+        std::memcpy(literals_, literals, kMaxSize);
+
+        for (int field = 0; field < kIso8601Fields; ++field) {
+            starts_[field] = fields.starts[field];
+            widths_[field] = fields.widths[field];
+        }
+
+        // The sign of a year is a literal
+        negative_ = row[fields.starts[kYearField]] == '-';
+        starts_[kYearField] += negative_ ? 1 : 0;
+        widths_[kYearField] -= negative_ ? 1 : 0;
+
+        has_offset_ = fields.has_offset;
+        offset_sign_ = fields.widths[kOffsetHourField] != 0 &&
+                                       row[fields.starts[kOffsetHourField] - 1] == '-'
+                               ? -1
+                               : 1;
+        words_ = (row.size() + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+        size_ = row.size();
+    }
+
+    bool decode(string_view row, Iso8601* out) const {
+        if (size_ == 0 || row.size() != size_) {
+            return false;
+        }
+
+        char buffer[kMaxSize] = {};
+        std::memcpy(buffer, row.data(), size_);
+
+        if (!matches(buffer)) {
+            return false;
+        }
+
+        out->year = number(buffer, kYearField) * (negative_ ? -1 : 1);
+        out->month = widths_[kMonthField] ? number(buffer, kMonthField) : 1;
+        out->day = widths_[kDayField] ? number(buffer, kDayField) : 1;
+        out->hour = number(buffer, kHourField);
+        out->minute = number(buffer, kMinuteField);
+        out->second = number(buffer, kSecondField);
+        out->nanos = 0;
+        out->has_offset = has_offset_;
+        out->offset = 0;
+
+        if (widths_[kFractionField]) {
+            const auto* fraction = buffer + starts_[kFractionField];
+            scan_fraction(fraction, fraction + widths_[kFractionField], &out->nanos);
+        }
+
+        if (widths_[kOffsetHourField]) {
+            const auto hours = number(buffer, kOffsetHourField);
+            const auto minutes = number(buffer, kOffsetMinuteField);
+            const auto seconds = number(buffer, kOffsetSecondField);
+
+            if (hours > 23 || minutes > 59 || seconds > 59) {
+                return false;
+            }
+
+            out->offset = offset_sign_ * ((hours * 60 + minutes) * 60 + seconds);
+        }
+
+        // The same ranges as the scanner, where -000 is the only invalid year
+        return (!negative_ || out->year != 0) && out->month >= 1 && out->month <= 12 &&
+               out->day >= 1 && out->day <= days_in_month(out->year, out->month) &&
+               out->hour <= 23 && out->minute <= 59 && out->second <= 60;
+    }
+
+   private:
+    // Compares eight characters at a time: the literals must be equal and the digits within
+    // '0' to '9', i.e. 0x3? before and after adding 6
+    bool matches(const char* buffer) const {
+        constexpr auto kHigh = 0xf0f0f0f0f0f0f0f0;
+        constexpr auto kZeros = 0x3030303030303030;
+        constexpr auto kSixes = 0x0606060606060606;
+
+        std::uint64_t mismatch = 0;
+
+        for (std::size_t i = 0; i < words_; ++i) {
+            std::uint64_t word;
+            std::memcpy(&word, buffer + i * sizeof(word), sizeof(word));
+
+            const auto digits = word & digits_[i];
+
+            mismatch |= (word & ~digits_[i]) ^ literals_[i];
+            mismatch |= (digits & kHigh) ^ (kZeros & digits_[i]);
+            mismatch |= ((digits + (kSixes & digits_[i])) & kHigh) ^ (kZeros & digits_[i]);
+        }
+
+        return mismatch == 0;
+    }
+
+    int number(const char* buffer, int field) const {
+        const auto* p = buffer + starts_[field];
+        int v = 0;
+
+        for (int i = 0; i < widths_[field]; ++i) {
+            v = v * 10 + (p[i] - '0');
+        }
+
+        return v;
+    }
+
+    std::size_t size_ = 0;
+    std::size_t words_ = 0;
+    std::uint64_t digits_[kWords];    // 0xff at the digits
+    std::uint64_t literals_[kWords];  // Any other character
+    std::uint8_t starts_[kIso8601Fields];
+    std::uint8_t widths_[kIso8601Fields];
+    bool negative_ = false;
+    bool has_offset_ = false;
+    int offset_sign_ = 1;
+};
+
+// Reads rows of the same shape at fixed positions, scanning only the rows of another shape
+class Iso8601Reader {
+   public:
+    bool read(string_view row, Iso8601* out) {
+        if (layout_.decode(row, out)) {
+            return true;
+        }
+
+        *out = Iso8601();
+
+        if (!scan_iso8601(row, out)) {
+            return false;
+        }
+
+        layout_.compile(row, *out);
+        return true;
+    }
+
+   private:
+    Iso8601Layout layout_;
+};
+
+// UTC instant of the fields, storing their nanoseconds. As in cctz::parse(), a leap second moves
+// forward to the following second and a skipped time resolves with the offset before the
+// transition.
+inline std::int64_t to_instant(const Iso8601& fields, const TransitionTable& table,
+                               std::int32_t* nanos) {
+    const auto leap = fields.second == 60 ? 1 : 0;
+    const auto local = days_from_civil(fields.year, fields.month, fields.day) * kSecondsPerDay +
+                       fields.hour * kSecondsPerHour + fields.minute * kSecondsPerMinute +
+                       fields.second - leap;
+
+    *nanos = leap ? 0 : fields.nanos;
+    return (fields.has_offset ? local - fields.offset : table.to_instant_pre(local)) + leap;
+}
+
+inline DateTime from_iso8601(const Iso8601& fields, ZoneId zone) {
+    std::int32_t nanos = 0;
+    const auto instant = to_instant(fields, internal::zone(zone).table, &nanos);
+
+    return DateTime::from_instant(instant, zone, nanos);
+}
+
+inline Expected<DateTime> try_parse_iso8601(string_view input, ZoneId zone) {
+    std::int64_t instant = 0;
+    std::int32_t nanos = 0;
+
+    if (decode_utc_timestamp(input, &instant, &nanos)) {
+        return DateTime::from_instant(instant, zone, nanos);
+    }
+
+    Iso8601 fields;
+
+    if (!scan_iso8601(input, &fields)) {
+        return Error(kUnsupportedFormat, "input: ", input);
     }
 
-    return dt;
+    return from_iso8601(fields, zone);
+}
+
+// Parses the rows of a column as try_parse() does, resolving the timezone once
+class ColumnParser {
+   public:
+    explicit ColumnParser(string_view tz)
+            : tz_(tz), zone_(zone_id(tz)), table_(internal::zone(zone_).table) {}
+
+    ZoneId zone() const { return zone_; }
+
+    bool read(string_view row, std::int64_t* instant, std::int32_t* nanos) {
+        if (decode_utc_timestamp(row, level_, instant, nanos)) {
+            return true;
+        }
+
+        Iso8601 fields;
+
+        if (reader_.read(row, &fields)) {
+            *instant = to_instant(fields, table_, nanos);
+            return true;
+        }
+
+        if (row == string_view("now")) {
+            const auto dt = pendulum::now(tz_);
+            *instant = dt.timestamp();
+            *nanos = dt.nanosecond();
+            return true;
+        }
+
+        return false;
+    }
+
+    // Same as DateTime::from_instant(), reusing the offset of the previous row within its span
+    DateTime datetime(std::int64_t instant, std::int32_t nanos) {
+        if (instant < begin_ || instant >= end_) {
+            const auto span = table_.span(instant);
+
+            begin_ = span.begin;
+            end_ = span.end;
+            offset_ = span.info.offset;
+        }
+
+        return DateTime(instant, zone_, nanos, offset_);
+    }
+
+   private:
+    string_view tz_;
+    ZoneId zone_;
+    const TransitionTable& table_;
+    Iso8601Reader reader_;
+    SimdLevel level_ = simd_level();
+    std::int64_t begin_ = 0;  // UTC instants [begin_, end_) which share offset_
+    std::int64_t end_ = 0;
+    std::int32_t offset_ = 0;
+};
+
+// Calls func(index, row) for each row of the buffer, split at the delimiter. A delimiter at the
+// end does not start another row.
+template <typename Func>
+inline void for_each_row(string_view buffer, char delimiter, Func func) {
+    std::size_t index = 0;
+    std::size_t begin = 0;
+
+    while (begin < buffer.size()) {
+        auto end = buffer.find(delimiter, begin);
+
+        if (end == string_view::npos) {
+            end = buffer.size();
+        }
+
+        func(index++, buffer.substr(begin, end - begin));
+        begin = end + 1;
+    }
+}
+
+inline std::size_t count_rows(string_view buffer, char delimiter) {
+    std::size_t n = 0;
+    for_each_row(buffer, delimiter, [&n](std::size_t, string_view) { ++n; });
+    return n;
 }
 
 }  // namespace internal
 
-inline DateTime from_format(const std::string& input, const std::string& fmt,
-                            const std::string& tz = "UTC") {
-    const auto& tz_ = internal::timezone(tz);
-    cctz::time_point<std::chrono::seconds> tp;
+inline Expected<DateTime> try_from_format(internal::string_view input, internal::string_view fmt,
+                                          internal::string_view tz = "UTC") {
+    const auto zone = internal::try_zone_id(tz);
 
-    if (fmt == "%Y%m%d") {
-        // cctz cannot parse '%Y%m%d'
-        return internal::from_ymd(input, tz);
+    if (!zone) {
+        return zone.error();
     }
 
-    const auto ok = cctz::parse(fmt, input, tz_, &tp);
+    return internal::try_from_format(input, fmt, *zone);
+}
+
+inline DateTime from_format(internal::string_view input, internal::string_view fmt,
+                            internal::string_view tz = "UTC") {
+    return try_from_format(input, fmt, tz).value();
+}
+
+inline Expected<DateTime> try_from_format(internal::string_view input, const Format& format,
+                                          internal::string_view tz = "UTC") {
+    const auto zone = internal::try_zone_id(tz);
 
-    if (!ok) {
-        throw UnsupportedFormat("input: " + input + " - format: " + fmt);
+    if (!zone) {
+        return zone.error();
     }
 
-    const auto& cs = cctz::convert(tp, tz_);
+    return internal::try_from_format(input, format, *zone);
+}
 
-    return DateTime(cs, tz_);
+inline DateTime from_format(internal::string_view input, const Format& format,
+                            internal::string_view tz = "UTC") {
+    return try_from_format(input, format, tz).value();
 }
 
-inline DateTime parse(const std::string& input, const std::string& tz = "UTC") {
-    static const std::string formats[] = {
-            // ISO 8601 extended format
-            "%E4Y-%m-%dT%H:%M:%S%Ez",
-            "%E4Y-%m-%dT%H:%M:%SZ",
-            // ISO 8601 datetime format
-            "%E4Y%m%dT%H%M%S%z",
-            "%E4Y-%m-%d %H:%M:%S",
-            // ISO 8601 date format
-            "%E4Y-%m-%d",
-            "%E4Y-%m",
-            "%E4Y%m%d",
-            "%E4Y",
-    };
+// Unlike parse(), a failed input costs no exception and no message
+inline Expected<DateTime> try_parse(internal::string_view input,
+                                    internal::string_view tz = "UTC") {
+    const auto zone = internal::try_zone_id(tz);
+
+    if (!zone) {
+        return zone.error();
+    }
 
-    if (input == "now") {
+    if (input == internal::string_view("now")) {
         return now(tz);
     }
 
-    for (const auto& fmt : formats) {
-        try {
-            return from_format(input, fmt, tz);
-        } catch (const UnsupportedFormat&) {
-            continue;
+    return internal::try_parse_iso8601(input, *zone);
+}
+
+inline DateTime parse(internal::string_view input, internal::string_view tz = "UTC") {
+    return try_parse(input, tz).value();
+}
+
+// Same as above for the characters [data, data + size), e.g. a field of a read buffer which is not
+// null-terminated
+inline Expected<DateTime> try_from_format(const char* data, std::size_t size,
+                                          internal::string_view fmt,
+                                          internal::string_view tz = "UTC") {
+    return try_from_format(internal::string_view(data, size), fmt, tz);
+}
+
+inline DateTime from_format(const char* data, std::size_t size, internal::string_view fmt,
+                            internal::string_view tz = "UTC") {
+    return try_from_format(data, size, fmt, tz).value();
+}
+
+inline Expected<DateTime> try_parse(const char* data, std::size_t size,
+                                    internal::string_view tz = "UTC") {
+    return try_parse(internal::string_view(data, size), tz);
+}
+
+inline DateTime parse(const char* data, std::size_t size, internal::string_view tz = "UTC") {
+    return try_parse(data, size, tz).value();
+}
+
+// Same as try_parse() for every row. Rows with the layout of the previous valid row, as in a
+// column of one format, decode at fixed positions; the others are scanned, and their layout is
+// kept in turn. Invalid rows get the epoch and a cleared bit instead of an error. Returns the
+// number of valid rows.
+inline std::size_t parse_many(const std::vector<internal::string_view>& rows,
+                              std::vector<DateTime>* out, ValidityBitmap* valid,
+                              internal::string_view tz = "UTC") {
+    internal::ColumnParser parser(tz);
+
+    out->assign(rows.size(), DateTime::from_instant(0, parser.zone()));
+    valid->assign(rows.size());
+
+    std::size_t n = 0;
+
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        std::int64_t instant = 0;
+        std::int32_t nanos = 0;
+
+        if (parser.read(rows[i], &instant, &nanos)) {
+            (*out)[i] = parser.datetime(instant, nanos);
+            valid->set(i);
+            ++n;
+        }
+    }
+
+    return n;
+}
+
+// Same as above, writing UTC time points, which leaves out the offsets of the rows. Rows out of
+// the range of the time points are invalid.
+inline std::size_t parse_many(
+        const std::vector<internal::string_view>& rows,
+        std::vector<std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>>*
+                out,
+        ValidityBitmap* valid, internal::string_view tz = "UTC") {
+    constexpr auto kMaxSeconds =
+            std::numeric_limits<std::int64_t>::max() / internal::kNanosecondsPerSecond;
+
+    internal::ColumnParser parser(tz);
+
+    out->assign(rows.size(), {});
+    valid->assign(rows.size());
+
+    std::size_t n = 0;
+
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        std::int64_t instant = 0;
+        std::int32_t nanos = 0;
+
+        if (parser.read(rows[i], &instant, &nanos) && instant > -kMaxSeconds &&
+            instant < kMaxSeconds) {
+            (*out)[i] += std::chrono::seconds(instant) + std::chrono::nanoseconds(nanos);
+            valid->set(i);
+            ++n;
         }
     }
 
-    throw UnsupportedFormat("input: " + input);
+    return n;
+}
+
+// Same as above for the rows of a buffer split at the delimiter, e.g. a column read from a file
+inline std::size_t parse_many(internal::string_view buffer, char delimiter,
+                              std::vector<DateTime>* out, ValidityBitmap* valid,
+                              internal::string_view tz = "UTC") {
+    internal::ColumnParser parser(tz);
+    const auto size = internal::count_rows(buffer, delimiter);
+
+    out->assign(size, DateTime::from_instant(0, parser.zone()));
+    valid->assign(size);
+
+    std::size_t n = 0;
+
+    internal::for_each_row(buffer, delimiter, [&](std::size_t i, internal::string_view row) {
+        std::int64_t instant = 0;
+        std::int32_t nanos = 0;
+
+        if (parser.read(row, &instant, &nanos)) {
+            (*out)[i] = parser.datetime(instant, nanos);
+            valid->set(i);
+            ++n;
+        }
+    });
+
+    return n;
 }
 
 }  // namespace pendulum
@@ -23,13 +23,20 @@
 #ifndef PENDULUM_H_
 #define PENDULUM_H_
 
+#include "pendulum/batch.h"
+#include "pendulum/calendar.h"
+#include "pendulum/clock.h"
 #include "pendulum/constants.h"
 #include "pendulum/date.h"
 #include "pendulum/datetime.h"
 #include "pendulum/exceptions.h"
+#include "pendulum/fixed_offset_datetime.h"
+#include "pendulum/format.h"
 #include "pendulum/helpers.h"
 #include "pendulum/parser.h"
 #include "pendulum/period.h"
+#include "pendulum/preload.h"
+#include "pendulum/simd.h"
 #include "pendulum/testing.h"
 
 #endif  // PENDULUM_H_
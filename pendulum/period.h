@@ -41,14 +41,11 @@ class DateTimeIterator {
     using reference = const DateTime&;
     using iterator_category = std::input_iterator_tag;
 
-    using Add = std::function<DateTime(const DateTime*)>;
-    using Compare = std::function<bool(const DateTime&, const DateTime&)>;
-
     DateTimeIterator() = default;
 
-    DateTimeIterator(const DateTime& start, const DateTime& stop, const Add& add,
-                     const Compare& cmp)
-            : dt_(start), stop_(stop), add_(add), cmp_(cmp) {}
+    // step is signed, and invert iterates backward down to stop
+    DateTimeIterator(const DateTime& start, const DateTime& stop, Unit unit, int step, bool invert)
+            : dt_(start), stop_(stop), unit_(unit), step_(step), invert_(invert) {}
 
     DateTimeIterator(const DateTimeIterator&) = default;
     DateTimeIterator(DateTimeIterator&&) = default;
@@ -80,9 +77,9 @@ class DateTimeIterator {
 
    private:
     void next() {
-        *dt_ = add_(&*dt_);
+        *dt_ = dt_->add(unit_, step_);
 
-        if (!cmp_(*dt_, *stop_)) {
+        if (invert_ ? *dt_ < *stop_ : *dt_ > *stop_) {
             clear();
         }
     }
@@ -90,14 +87,13 @@ class DateTimeIterator {
     void clear() {
         dt_ = internal::nullopt;
         stop_ = internal::nullopt;
-        add_ = nullptr;
-        cmp_ = nullptr;
     }
 
     internal::optional<DateTime> dt_;
     internal::optional<DateTime> stop_;
-    Add add_;
-    Compare cmp_;
+    Unit unit_ = Unit::kDay;
+    int step_ = 1;
+    bool invert_ = false;
 };
 
 class DateTimeRange {
@@ -157,47 +153,54 @@ class Period {
 
     int in_hours() const { return in_minutes() / 60; }
     int in_minutes() const { return in_seconds() / 60; }
-    int in_seconds() const { return stop_.timestamp() - start_.timestamp(); }
+    // Whole seconds, truncated toward zero like the other units
+    int in_seconds() const {
+        const auto seconds = stop_.timestamp() - start_.timestamp();
+        const auto nanos = stop_.nanosecond() - start_.nanosecond();
+
+        if (seconds > 0 && nanos < 0) {
+            return static_cast<int>(seconds - 1);
+        }
+        if (seconds < 0 && nanos > 0) {
+            return static_cast<int>(seconds + 1);
+        }
+
+        return static_cast<int>(seconds);
+    }
 
     bool contains(const DateTime& dt) const { return start_ <= dt && dt <= stop_; }
 
+    DateTimeRange range(Unit unit, int step = 1) const {
+        return DateTimeRange(DateTimeIterator(start_, stop_, unit, step * sign(), invert_),
+                             DateTimeIterator());
+    }
+
+    template <Unit U>
+    DateTimeRange range(int step = 1) const {
+        return range(U, step);
+    }
+
     DateTimeRange range(const std::string& unit, int step = 1) const {
-        using namespace std::placeholders;
-        DateTimeIterator::Add add;
-
-        if (unit == "years") {
-            add = std::bind(&DateTime::add_years, _1, step * sign());
-        } else if (unit == "months") {
-            add = std::bind(&DateTime::add_months, _1, step * sign());
-        } else if (unit == "days") {
-            add = std::bind(&DateTime::add_days, _1, step * sign());
-        } else if (unit == "hours") {
-            add = std::bind(&DateTime::add_hours, _1, step * sign());
-        } else if (unit == "minutes") {
-            add = std::bind(&DateTime::add_minutes, _1, step * sign());
-        } else if (unit == "seconds") {
-            add = std::bind(&DateTime::add_seconds, _1, step * sign());
-        } else {
-            throw InvalidUnit("unit for range(): " + unit);
+        return try_range(unit, step).value();
+    }
+
+    Expected<DateTimeRange> try_range(const std::string& unit, int step = 1) const {
+        const auto u = internal::to_unit(unit, true);
+
+        if (!u) {
+            return Error(kInvalidUnit, "unit for range(): ", unit);
         }
 
-        return DateTimeRange(DateTimeIterator(start_, stop_, add, cmp()), DateTimeIterator());
+        return range(*u, step);
     }
 
     DateTimeIterator begin() const {
-        using namespace std::placeholders;
-        const auto& add = std::bind(&DateTime::add_days, _1, sign());
-        return DateTimeIterator(start_, stop_, add, cmp());
+        return DateTimeIterator(start_, stop_, Unit::kDay, sign(), invert_);
     }
 
     DateTimeIterator end() const { return DateTimeIterator(); }
 
    private:
-    DateTimeIterator::Compare cmp() const {
-        return invert_ ? [](const DateTime& dt, const DateTime& stop) { return dt >= stop; }
-                       : [](const DateTime& dt, const DateTime& stop) { return dt <= stop; };
-    }
-
     int sign() const { return invert_ ? -1 : 1; }
 
     DateTime start_;
@@ -231,18 +234,16 @@ struct hash<pendulum::Period> {
     hash& operator=(hash&&) = default;
 
     size_t operator()(const pendulum::Period& period) const {
-        const auto& start = period.start().to_iso8601_string();
-        const auto& stop = period.stop().to_iso8601_string();
-
         const size_t hash_values[] = {
-                hash<std::string>()(start + "/" + stop),
+                hash<pendulum::DateTime>()(period.start()),
+                hash<pendulum::DateTime>()(period.stop()),
                 hash<bool>()(period.absolute()),
         };
 
         size_t seed = 0;
 
         for (auto hash_value : hash_values) {
-            seed ^= hash_value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            seed = pendulum::internal::hash_combine(seed, hash_value);
         }
 
         return seed;
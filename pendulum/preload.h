@@ -0,0 +1,242 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_PRELOAD_H_
+#define PENDULUM_PRELOAD_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pendulum/internal.h"
+#include "pendulum/timezone.h"
+
+#ifdef PENDULUM_EMBEDDED_TZDATA
+#include "pendulum/tzdata.h"
+#endif
+
+namespace pendulum {
+
+struct ZoneLoadReport {
+    std::string name;
+    bool loaded;
+    std::chrono::nanoseconds duration;
+    // Bytes held by the registry for the zone, plus an estimate of the transitions cctz keeps
+    std::size_t memory_usage;
+};
+
+struct PreloadReport {
+    std::vector<ZoneLoadReport> zones;  // in the order of the requested names
+    std::chrono::nanoseconds duration;  // wall time of the whole preload
+
+    std::size_t loaded() const {
+        return std::count_if(zones.begin(), zones.end(),
+                             [](const ZoneLoadReport& zone) { return zone.loaded; });
+    }
+
+    std::size_t memory_usage() const {
+        std::size_t bytes = 0;
+        for (const auto& zone : zones) {
+            bytes += zone.memory_usage;
+        }
+
+        return bytes;
+    }
+};
+
+namespace internal {
+
+// Zones and links listed by the tzdata.zi of ${TZDIR}, or its zone1970.tab which only has
+// canonical zones
+inline std::vector<std::string> system_zone_names() {
+    std::vector<std::string> names;
+    const auto dir = zoneinfo_dir();
+    std::string line;
+
+    std::ifstream zi(dir + "/tzdata.zi");
+    while (std::getline(zi, line)) {
+        std::istringstream iss(line);
+        std::string kind, first, second;
+
+        if (!(iss >> kind >> first)) {
+            continue;
+        }
+
+        if (kind == "Z") {
+            names.push_back(first);
+        } else if (kind == "L" && iss >> second) {
+            names.push_back(second);
+        }
+    }
+
+    if (names.empty()) {
+        std::ifstream tab(dir + "/zone1970.tab");
+        while (std::getline(tab, line)) {
+            std::istringstream iss(line);
+            std::string codes, coordinates, name;
+
+            if (!line.empty() && line[0] != '#' && iss >> codes >> coordinates >> name) {
+                names.push_back(name);
+            }
+        }
+    }
+
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    return names;
+}
+
+// Estimate of what cctz holds for a loaded zone, which it does not expose: the transitions the
+// table mirrors, each an instant with the civil times around it, and a fixed part for the types,
+// abbreviations and future rule
+constexpr std::size_t kCctzZoneSize = 512;
+constexpr std::size_t kCctzTransitionSize =
+        2 * sizeof(std::int64_t) + 2 * sizeof(cctz::civil_second);
+
+inline std::size_t zone_memory_usage(const Zone& zone) {
+    const auto cctz_size = kCctzZoneSize + zone.table.instants().size() * kCctzTransitionSize;
+    return sizeof(Zone) + zone.name.capacity() + zone.table.memory_usage() + cctz_size;
+}
+
+inline bool is_zone_name_char(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+           c == '/' || c == '_' || c == '+' || c == '-';
+}
+
+inline ZoneLoadReport preload_zone(const std::string& name) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto id = name == "local" ? optional<ZoneId>(zone_id(name))
+                                    : ZoneRegistry::instance().load(name);
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    return {name, id.has_value(),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration),
+            id ? zone_memory_usage(zone(*id)) : 0};
+}
+
+}  // namespace internal
+
+// Names of all zones that preload_all_timezones() loads: the zones listed by the system tzdata,
+// along with the embedded zones if tzdata is embedded, as the others are still read from the system
+inline std::vector<std::string> available_timezones() {
+    auto names = internal::system_zone_names();
+
+#ifdef PENDULUM_EMBEDDED_TZDATA
+    const auto& tzdata = internal::embedded_tzdata();
+
+    for (std::size_t i = 0; i < tzdata.size; ++i) {
+        names.push_back(tzdata.zones[i].name);
+    }
+
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+#endif
+
+    return names;
+}
+
+// Loads the zones on up to `threads` threads (hardware concurrency if 0), so that later lookups
+// do not load them lazily. Unknown zones are reported as not loaded instead of throwing.
+inline PreloadReport preload_timezones(const std::vector<std::string>& names,
+                                       unsigned threads = 0) {
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, names.size()));
+
+    PreloadReport report;
+    report.zones.resize(names.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<std::size_t> next(0);
+
+    const auto work = [&names, &report, &next]() {
+        for (auto i = next++; i < names.size(); i = next++) {
+            report.zones[i] = internal::preload_zone(names[i]);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < threads; ++i) {
+        pool.emplace_back(work);
+    }
+
+    work();
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    report.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+
+    return report;
+}
+
+inline PreloadReport preload_all_timezones(unsigned threads = 0) {
+    return preload_timezones(available_timezones(), threads);
+}
+
+// Available zones named in a text such as a configuration file, in the order they first appear.
+// Names are the words of letters, digits and "/_+-".
+inline std::vector<std::string> timezones_in(internal::string_view text) {
+    // Sorted
+    const auto available = available_timezones();
+
+    std::vector<std::string> names;
+
+    for (std::size_t i = 0; i < text.size();) {
+        if (!internal::is_zone_name_char(text[i])) {
+            ++i;
+            continue;
+        }
+
+        const auto begin = i;
+        while (i < text.size() && internal::is_zone_name_char(text[i])) {
+            ++i;
+        }
+
+        const std::string word(text.data() + begin, i - begin);
+
+        if (std::binary_search(available.begin(), available.end(), word) &&
+            std::find(names.begin(), names.end(), word) == names.end()) {
+            names.push_back(word);
+        }
+    }
+
+    return names;
+}
+
+inline PreloadReport preload_timezones_in(internal::string_view text, unsigned threads = 0) {
+    return preload_timezones(timezones_in(text), threads);
+}
+
+}  // namespace pendulum
+
+#endif  // PENDULUM_PRELOAD_H_
@@ -0,0 +1,323 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_SIMD_H_
+#define PENDULUM_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && \
+        !defined(PENDULUM_NO_SIMD)
+#define PENDULUM_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#include "pendulum/calendar.h"
+#include "pendulum/constants.h"
+#include "pendulum/internal.h"
+
+namespace pendulum {
+namespace internal {
+
+enum class SimdLevel { kScalar, kSse41, kAvx2 };
+
+// Best instruction set of the CPU, detected once
+inline SimdLevel simd_level() {
+#ifdef PENDULUM_X86_SIMD
+    static const SimdLevel level = __builtin_cpu_supports("avx2")     ? SimdLevel::kAvx2
+                                   : __builtin_cpu_supports("sse4.1") ? SimdLevel::kSse41
+                                                                      : SimdLevel::kScalar;
+    return level;
+#else
+    return SimdLevel::kScalar;
+#endif
+}
+
+// Characters of a fixed-width UTC timestamp, YYYY-MM-DDThh:mm:ssZ with 0 to 9 fractional digits
+// before the Z, padded with zeros to 32 bytes
+struct UtcLayout {
+    static constexpr std::size_t kSize = 32;
+    static constexpr std::size_t kMinSize = 20;
+    static constexpr std::size_t kMaxSize = 30;
+
+    // Digits are within [pattern, pattern + limit], i.e. '0' + 9, and other characters equal
+    alignas(32) unsigned char pattern[kSize];
+    alignas(32) unsigned char limit[kSize];
+    // Digits of the seconds and of the fraction in the upper 16 bytes, after the shuffle below
+    alignas(16) unsigned char upper_digits[16];
+    // Moves the last 16 characters to the upper 16 bytes, with zeros past the end
+    alignas(16) unsigned char tail[16];
+};
+
+inline const UtcLayout* utc_layout(std::size_t size) {
+    struct Layouts {
+        Layouts() {
+            std::memset(layouts, 0, sizeof(layouts));
+
+            for (auto size = UtcLayout::kMinSize; size <= UtcLayout::kMaxSize; ++size) {
+                auto& layout = layouts[size - UtcLayout::kMinSize];
+                const char* date_time = "0000-00-00T00:00:00";
+
+                for (std::size_t i = 0; i < 19; ++i) {
+                    layout.pattern[i] = static_cast<unsigned char>(date_time[i]);
+                }
+
+                for (std::size_t i = 20; i + 1 < size; ++i) {
+                    layout.pattern[i] = '0';
+                    layout.upper_digits[i - 16] = 0xff;
+                }
+
+                for (std::size_t i = 0; i < size; ++i) {
+                    layout.limit[i] = layout.pattern[i] == '0' ? 9 : 0;
+                }
+
+                layout.pattern[19] = size == UtcLayout::kMinSize ? 'Z' : '.';
+                layout.pattern[size - 1] = 'Z';
+                layout.upper_digits[0] = 0xff;
+                layout.upper_digits[1] = 0xff;
+
+                for (std::size_t i = 0; i < 16; ++i) {
+                    layout.tail[i] =
+                            static_cast<unsigned char>(16 + i < size ? i + 32 - size : 0x80);
+                }
+            }
+        }
+
+        UtcLayout layouts[UtcLayout::kMaxSize - UtcLayout::kMinSize + 1];
+    };
+
+    static const Layouts layouts;
+
+    // A decimal mark without digits is not a timestamp
+    if (size < UtcLayout::kMinSize || size > UtcLayout::kMaxSize ||
+        size == UtcLayout::kMinSize + 1) {
+        return nullptr;
+    }
+
+    return &layouts.layouts[size - UtcLayout::kMinSize];
+}
+
+// Fields of a UTC timestamp, as decoded by every instruction set
+struct UtcFields {
+    int year;
+    int month;
+    int day;
+    int hour;
+    int minute;
+    int second;
+    std::int32_t nanos;
+};
+
+// Leap seconds are left to the scanner. Years of four digits keep to unsigned 32-bit arithmetic,
+// whose divisions by constants are multiplications, unlike days_from_civil() on 64-bit years.
+inline bool to_utc_instant(const UtcFields& f, std::int64_t* instant, std::int32_t* nanos) {
+    const auto year = static_cast<std::uint32_t>(f.year);
+    const bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    const int month_days = f.month == 2 ? 28 + leap : 30 + ((f.month + (f.month >> 3)) & 1);
+
+    if (f.month < 1 || f.month > 12 || f.day < 1 || f.day > month_days || f.hour > 23 ||
+        f.minute > 59 || f.second > 59) {
+        return false;
+    }
+
+    // Years from March, shifted by an era so that January and February of year 0 stay positive
+    const std::uint32_t march_year = year + 400 - (f.month <= 2 ? 1 : 0);
+    const std::uint32_t era = march_year / 400;
+    const std::uint32_t yoe = march_year % 400;
+    const std::int64_t days = std::int64_t{era} * 146097 + yoe * 365 + yoe / 4 - yoe / 100 +
+                              days_since_march(f.month, f.day) - 719468 - 146097;
+
+    *instant = days * kSecondsPerDay + f.hour * kSecondsPerHour + f.minute * kSecondsPerMinute +
+               f.second;
+    *nanos = f.nanos;
+    return true;
+}
+
+inline bool decode_utc_scalar(const unsigned char* buffer, const UtcLayout& layout,
+                              std::int64_t* instant, std::int32_t* nanos) {
+    bool mismatch = false;
+
+    for (std::size_t i = 0; i < UtcLayout::kSize; ++i) {
+        mismatch |= static_cast<unsigned char>(buffer[i] - layout.pattern[i]) > layout.limit[i];
+    }
+
+    if (mismatch) {
+        return false;
+    }
+
+    const auto pair = [buffer](int i) { return (buffer[i] - '0') * 10 + (buffer[i + 1] - '0'); };
+
+    std::int32_t fraction = 0;
+    std::int32_t scale = kNanosecondsPerSecond;
+
+    for (std::size_t i = 20; i < UtcLayout::kSize && layout.limit[i] != 0; ++i) {
+        scale /= 10;
+        fraction += (buffer[i] - '0') * scale;
+    }
+
+    const UtcFields fields{pair(0) * 100 + pair(2), pair(5), pair(8), pair(11), pair(14), pair(17),
+                           fraction};
+
+    return to_utc_instant(fields, instant, nanos);
+}
+
+#ifdef PENDULUM_X86_SIMD
+
+// Reads the fields out of the pairs of digits which decode_utc_sse41() and decode_utc_avx2() put
+// together: YY yy MM DD hh mm in the lower half, ss and the fraction in the upper one
+__attribute__((target("sse4.1"))) inline bool finish_utc(__m128i lower, __m128i upper,
+                                                          std::int64_t* instant,
+                                                          std::int32_t* nanos) {
+    // 4 + 4 + 1 fractional digits, with the last one times 10
+    const auto fraction = _mm_madd_epi16(upper, _mm_setr_epi16(0, 0, 100, 1, 100, 1, 1, 0));
+
+    const UtcFields fields{
+            _mm_extract_epi16(lower, 0) * 100 + _mm_extract_epi16(lower, 1),
+            _mm_extract_epi16(lower, 2),
+            _mm_extract_epi16(lower, 3),
+            _mm_extract_epi16(lower, 4),
+            _mm_extract_epi16(lower, 5),
+            _mm_extract_epi16(upper, 0),
+            _mm_extract_epi32(fraction, 1) * 100000 + _mm_extract_epi32(fraction, 2) * 10 +
+                    _mm_extract_epi32(fraction, 3) / 10,
+    };
+
+    return to_utc_instant(fields, instant, nanos);
+}
+
+// Byte shuffles which gather the digits by pairs, and the weights which then multiply-add them
+#define PENDULUM_UTC_LOWER_SHUFFLE 0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1
+#define PENDULUM_UTC_UPPER_SHUFFLE 1, 2, -1, -1, 4, 5, 6, 7, 8, 9, 10, 11, 12, -1, -1, -1
+#define PENDULUM_UTC_WEIGHTS 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1
+
+// Loads the characters as the zero-padded buffer of decode_utc_scalar(), without copying them
+__attribute__((target("sse4.1"))) inline __m128i load_utc_tail(string_view input,
+                                                               const UtcLayout& layout) {
+    const auto* last = input.data() + input.size() - 16;
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(last)),
+                            _mm_load_si128(reinterpret_cast<const __m128i*>(layout.tail)));
+}
+
+__attribute__((target("sse4.1"))) inline bool decode_utc_sse41(string_view input,
+                                                                const UtcLayout& layout,
+                                                                std::int64_t* instant,
+                                                                std::int32_t* nanos) {
+    const auto* pattern = reinterpret_cast<const __m128i*>(layout.pattern);
+    const auto* limit = reinterpret_cast<const __m128i*>(layout.limit);
+    const auto lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data()));
+    const auto upper = load_utc_tail(input, layout);
+
+    // Unsigned distances from the pattern may not exceed the limits
+    const auto lower_distance = _mm_sub_epi8(lower, _mm_load_si128(pattern));
+    const auto upper_distance = _mm_sub_epi8(upper, _mm_load_si128(pattern + 1));
+    const auto lower_ok = _mm_cmpeq_epi8(_mm_max_epu8(lower_distance, _mm_load_si128(limit)),
+                                         _mm_load_si128(limit));
+    const auto upper_ok = _mm_cmpeq_epi8(_mm_max_epu8(upper_distance, _mm_load_si128(limit + 1)),
+                                         _mm_load_si128(limit + 1));
+
+    if (_mm_movemask_epi8(_mm_and_si128(lower_ok, upper_ok)) != 0xffff) {
+        return false;
+    }
+
+    const auto zeros = _mm_set1_epi8('0');
+    const auto weights = _mm_setr_epi8(PENDULUM_UTC_WEIGHTS);
+    const auto lower_digits =
+            _mm_shuffle_epi8(_mm_sub_epi8(lower, zeros), _mm_setr_epi8(PENDULUM_UTC_LOWER_SHUFFLE));
+    const auto upper_digits = _mm_and_si128(
+            _mm_shuffle_epi8(_mm_sub_epi8(upper, zeros), _mm_setr_epi8(PENDULUM_UTC_UPPER_SHUFFLE)),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(layout.upper_digits)));
+
+    return finish_utc(_mm_maddubs_epi16(lower_digits, weights),
+                      _mm_maddubs_epi16(upper_digits, weights), instant, nanos);
+}
+
+__attribute__((target("avx2"))) inline bool decode_utc_avx2(string_view input,
+                                                             const UtcLayout& layout,
+                                                             std::int64_t* instant,
+                                                             std::int32_t* nanos) {
+    const auto chars = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data()))),
+            load_utc_tail(input, layout), 1);
+    const auto pattern = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.pattern));
+    const auto limit = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.limit));
+    const auto distance = _mm256_sub_epi8(chars, pattern);
+
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(distance, limit), limit)) != -1) {
+        return false;
+    }
+
+    // The shuffle stays within each 16-byte lane, as in decode_utc_sse41()
+    const auto upper_digits = _mm_load_si128(reinterpret_cast<const __m128i*>(layout.upper_digits));
+    const auto digits = _mm256_and_si256(
+            _mm256_shuffle_epi8(_mm256_sub_epi8(chars, _mm256_set1_epi8('0')),
+                                _mm256_setr_epi8(PENDULUM_UTC_LOWER_SHUFFLE,
+                                                 PENDULUM_UTC_UPPER_SHUFFLE)),
+            _mm256_inserti128_si256(_mm256_set1_epi8(-1), upper_digits, 1));
+    const auto pairs = _mm256_maddubs_epi16(digits, _mm256_setr_epi8(PENDULUM_UTC_WEIGHTS,
+                                                                     PENDULUM_UTC_WEIGHTS));
+
+    return finish_utc(_mm256_castsi256_si128(pairs), _mm256_extracti128_si256(pairs, 1), instant,
+                      nanos);
+}
+
+#undef PENDULUM_UTC_LOWER_SHUFFLE
+#undef PENDULUM_UTC_UPPER_SHUFFLE
+#undef PENDULUM_UTC_WEIGHTS
+
+#endif  // PENDULUM_X86_SIMD
+
+// Decodes YYYY-MM-DDThh:mm:ss[.fffffffff]Z into a UTC instant with the given instruction set.
+// Anything else, leap seconds included, is rejected and left to the scanner.
+inline bool decode_utc_timestamp(string_view input, SimdLevel level, std::int64_t* instant,
+                                 std::int32_t* nanos) {
+    const auto* layout = utc_layout(input.size());
+
+    if (layout == nullptr || input.back() != 'Z') {
+        return false;
+    }
+
+    switch (level) {
+#ifdef PENDULUM_X86_SIMD
+        case SimdLevel::kAvx2:
+            return decode_utc_avx2(input, *layout, instant, nanos);
+        case SimdLevel::kSse41:
+            return decode_utc_sse41(input, *layout, instant, nanos);
+#endif
+        default:
+            break;
+    }
+
+    alignas(32) unsigned char buffer[UtcLayout::kSize] = {};
+    std::memcpy(buffer, input.data(), input.size());
+    return decode_utc_scalar(buffer, *layout, instant, nanos);
+}
+
+inline bool decode_utc_timestamp(string_view input, std::int64_t* instant, std::int32_t* nanos) {
+    return decode_utc_timestamp(input, simd_level(), instant, nanos);
+}
+
+}  // namespace internal
+}  // namespace pendulum
+
+#endif  // PENDULUM_SIMD_H_
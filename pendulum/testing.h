@@ -25,6 +25,8 @@
 
 #include <functional>
 
+#include "pendulum/clock.h"
+#include "pendulum/constants.h"
 #include "pendulum/datetime.h"
 #include "pendulum/internal.h"
 
@@ -52,17 +54,46 @@ class Finally {
     std::function<void()> action_;
 };
 
-inline optional<DateTime>& test_now() {
-    static optional<DateTime> now;
-    return now;
+// Returns the same date time whichever timezone is asked for
+class TestClock final : public Clock {
+   public:
+    time_point read() override { return now_.time_point<duration>(); }
+    DateTime now(string_view) override { return now_; }
+    DateTime day(string_view, int days) override {
+        return now_.start_of(Unit::kDay).add_days(days);
+    }
+
+    DateTime now_;
+    Clock* previous_ = nullptr;
+};
+
+inline TestClock& test_clock() {
+    thread_local TestClock clock;
+    return clock;
 }
 
 }  // namespace internal
 
-inline bool has_test_now() { return internal::test_now().has_value(); }
-inline DateTime get_test_now() { return internal::test_now().value(); }
-inline void set_test_now(const DateTime& now) { internal::test_now() = now; }
-inline void set_test_now() { internal::test_now() = internal::nullopt; }
+// The test now is set per thread
+inline bool has_test_now() { return internal::current_clock() == &internal::test_clock(); }
+inline DateTime get_test_now() { return internal::test_clock().now_; }
+
+inline void set_test_now(const DateTime& now) {
+    auto& clock = internal::test_clock();
+
+    if (!has_test_now()) {
+        clock.previous_ = internal::current_clock();
+        internal::current_clock() = &clock;
+    }
+
+    clock.now_ = now;
+}
+
+inline void set_test_now() {
+    if (has_test_now()) {
+        internal::current_clock() = internal::test_clock().previous_;
+    }
+}
 
 inline void test(const DateTime& now, std::function<void()> func) {
     internal::Finally finally([] { set_test_now(); });
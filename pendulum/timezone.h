@@ -23,37 +23,588 @@
 #ifndef PENDULUM_TIMEZONE_H_
 #define PENDULUM_TIMEZONE_H_
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/stat.h>
 
 #include <cctz/time_zone.h>
+#include <cctz/zone_info_source.h>
 
 #include "pendulum/exceptions.h"
+#include "pendulum/internal.h"
+#include "pendulum/transitions.h"
 
 namespace pendulum {
 namespace internal {
 
-inline cctz::time_zone timezone(const std::string& name) {
-    if (name == "UTC") {
-        return cctz::utc_time_zone();
+using ZoneId = std::uint32_t;
+
+constexpr ZoneId kUtcZoneId = 0;
+constexpr ZoneId kNoZoneId = std::numeric_limits<ZoneId>::max();
+
+constexpr std::size_t kZoneChunkSize = 64;
+constexpr std::size_t kMaxZoneChunks = 1024;
+
+// Fixed offsets every 15 minutes from -14:00 to +14:00 are registered up front
+constexpr std::int32_t kPooledOffsetStep = 15 * 60;
+constexpr std::int32_t kMaxPooledOffset = 14 * 60 * 60;
+constexpr std::size_t kPooledOffsets = 2 * kMaxPooledOffset / kPooledOffsetStep + 1;
+
+// How often the local zone is checked for changes of TZ or the file it is loaded from
+constexpr std::uint64_t kLocalZoneCheckInterval = 1;  // seconds
+
+struct Zone {
+    std::string name;
+    cctz::time_zone tz;
+    TransitionTable table;
+};
+
+inline std::string zoneinfo_dir() {
+    const char* dir = std::getenv("TZDIR");
+    return dir != nullptr && *dir != '\0' ? dir : "/usr/share/zoneinfo";
+}
+
+// Where the local zone comes from, resolved the same way as cctz::local_time_zone(), along with
+// the identity of the file backing it so that replacing the file is noticed
+struct LocalZoneSource {
+    std::string name;
+    std::string path;
+    bool exists;
+    dev_t dev;
+    ino_t ino;
+    time_t mtime;
+    off_t size;
+
+    static LocalZoneSource current() {
+        const char* tz = std::getenv("TZ");
+        std::string name = tz != nullptr ? tz : "localtime";
+
+        if (!name.empty() && name[0] == ':') {
+            name.erase(0, 1);
+        }
+
+        if (name == "localtime") {
+            const char* localtime = std::getenv("LOCALTIME");
+            name = localtime != nullptr ? localtime : "/etc/localtime";
+        }
+
+        const auto dir = zoneinfo_dir();
+        auto path = !name.empty() && name[0] == '/' ? name : dir + "/" + name;
+
+        // A link such as /etc/localtime -> /usr/share/zoneinfo/Asia/Tokyo is swapped rather than
+        // rewritten, so load its target, which cctz has not cached under the old contents
+        if (!name.empty() && name[0] == '/') {
+            const auto resolved = real_path(path);
+            const auto root = real_path(dir) + "/";
+
+            if (!resolved.empty()) {
+                path = resolved;
+                name = resolved.compare(0, root.size(), root) == 0 ? resolved.substr(root.size())
+                                                                    : resolved;
+            }
+        }
+
+        struct stat st;
+        const auto exists = ::stat(path.c_str(), &st) == 0;
+
+        return {name,
+                path,
+                exists,
+                exists ? st.st_dev : 0,
+                exists ? st.st_ino : 0,
+                exists ? st.st_mtime : 0,
+                exists ? st.st_size : 0};
     }
 
-    if (name == "local") {
-        return cctz::local_time_zone();
+    bool operator==(const LocalZoneSource& other) const {
+        return name == other.name && exists == other.exists && dev == other.dev &&
+               ino == other.ino && mtime == other.mtime && size == other.size;
     }
 
-    cctz::time_zone tz;
-    auto ok = cctz::load_time_zone(name, &tz);
+    bool operator!=(const LocalZoneSource& other) const { return !(*this == other); }
+
+   private:
+    static std::string real_path(const std::string& path) {
+        std::unique_ptr<char, void (*)(void*)> resolved(::realpath(path.c_str(), nullptr),
+                                                        std::free);
+        return resolved ? std::string(resolved.get()) : std::string();
+    }
+};
+
+// cctz caches zones by name, so the local zone is loaded again after its file was rewritten in
+// place under the name "pendulum-local:<hash of the contents>:<name>", which the factory below
+// serves as <name>
+constexpr char kLocalZoneKeyPrefix[] = "pendulum-local:";
+
+using ZoneInfoSourceFactory = std::unique_ptr<cctz::ZoneInfoSource> (*)(
+        const std::string&,
+        const std::function<std::unique_ptr<cctz::ZoneInfoSource>(const std::string&)>&);
+
+// Factory installed before this one, such as the one serving embedded tzdata
+inline ZoneInfoSourceFactory& next_zone_info_source_factory() {
+    static ZoneInfoSourceFactory next = nullptr;
+    return next;
+}
+
+inline std::unique_ptr<cctz::ZoneInfoSource> local_zone_info_source(
+        const std::string& name,
+        const std::function<std::unique_ptr<cctz::ZoneInfoSource>(const std::string&)>& fallback) {
+    constexpr auto kPrefixSize = sizeof(kLocalZoneKeyPrefix) - 1;
+
+    if (name.compare(0, kPrefixSize, kLocalZoneKeyPrefix) == 0) {
+        const auto colon = name.find(':', kPrefixSize);
+
+        if (colon != std::string::npos) {
+            return next_zone_info_source_factory()(name.substr(colon + 1), fallback);
+        }
+    }
+
+    return next_zone_info_source_factory()(name, fallback);
+}
+
+// Process-wide registry which interns timezones into compact ids.
+//
+// Zones live in append-only chunks, so a Zone never moves once registered. Names are resolved
+// through an immutable hash index that is republished on every insertion, which means looking up
+// a zone that has already been loaded takes no lock at all. Only loading a new zone serializes.
+//
+// The local zone is resolved once and cached. It is registered apart from the name index as
+// "local", and re-resolved when TZ or the file it is loaded from changes, which is checked at
+// most every kLocalZoneCheckInterval. Zones replaced that way stay valid, and are used again when
+// the same name and contents come back, so a file which is only touched keeps its id.
+//
+// Fixed offsets are resolved without building names: the common ones come from a dense table
+// filled at construction, and any other offset from a second index keyed by the offset itself.
+class ZoneRegistry {
+   public:
+    static ZoneRegistry& instance() {
+        static ZoneRegistry registry;
+        return registry;
+    }
+
+    ZoneRegistry(const ZoneRegistry&) = delete;
+    ZoneRegistry(ZoneRegistry&&) = delete;
+
+    ~ZoneRegistry() = default;
+
+    ZoneRegistry& operator=(const ZoneRegistry&) = delete;
+    ZoneRegistry& operator=(ZoneRegistry&&) = delete;
+
+    optional<ZoneId> find(string_view name) const {
+        const auto* index = index_.load(std::memory_order_acquire);
+        const auto hash = hash_name(name);
 
-    if (!ok) {
-        throw InvalidTimezone("tz: " + name);
+        for (auto i = hash & index->mask;; i = (i + 1) & index->mask) {
+            const auto& slot = index->slots[i];
+
+            if (slot.id == kNoZoneId) {
+                return nullopt;
+            }
+
+            if (slot.hash == hash && string_view(zone(slot.id).name) == name) {
+                return slot.id;
+            }
+        }
+    }
+
+    optional<ZoneId> find_fixed(std::int32_t seconds) const {
+        if (seconds % kPooledOffsetStep == 0 && -kMaxPooledOffset <= seconds &&
+            seconds <= kMaxPooledOffset) {
+            return pooled_[(seconds + kMaxPooledOffset) / kPooledOffsetStep];
+        }
+
+        const auto* index = fixed_index_.load(std::memory_order_acquire);
+        const auto hash = hash_offset(seconds);
+
+        for (auto i = hash & index->mask;; i = (i + 1) & index->mask) {
+            const auto& slot = index->slots[i];
+
+            if (slot.id == kNoZoneId) {
+                return nullopt;
+            }
+
+            // hash_offset() is a bijection, so equal hashes mean equal offsets
+            if (slot.hash == hash) {
+                return slot.id;
+            }
+        }
+    }
+
+    optional<ZoneId> load(string_view name) {
+        const auto id = find(name);
+
+        if (id) {
+            return id;
+        }
+
+        // Loading may hit the filesystem and compiling walks every transition, so do both before
+        // taking the lock
+        cctz::time_zone tz;
+
+        if (!cctz::load_time_zone(std::string(name.data(), name.size()), &tz)) {
+            return nullopt;
+        }
+
+        return insert(name, tz, TransitionTable(tz));
+    }
+
+    ZoneId intern(const cctz::time_zone& tz) {
+        const auto& name = tz.name();
+        const auto id = find(name);
+
+        if (id) {
+            return *id;
+        }
+
+        return insert(name, tz, TransitionTable(tz));
+    }
+
+    ZoneId fixed(std::int32_t seconds) {
+        const auto id = find_fixed(seconds);
+
+        if (id) {
+            return *id;
+        }
+
+        return insert_fixed(seconds);
+    }
+
+    ZoneId local() {
+        // time() is much cheaper than the steady clock, and a clock that went back is just one
+        // more reason to check
+        const auto now = static_cast<std::int64_t>(std::time(nullptr));
+
+        if (is_fresh(now, local_checked_.load(std::memory_order_acquire))) {
+            return local_.load(std::memory_order_acquire);
+        }
+
+        return refresh_local(now);
+    }
+
+    // Makes the next local() check whether the local zone changed, e.g. after setting TZ
+    void invalidate_local() {
+        local_checked_.store(std::numeric_limits<std::int64_t>::min(), std::memory_order_release);
+        local_generation_.fetch_add(1, std::memory_order_release);
+    }
+
+    // Counts invalidate_local() calls, so that caches of local() can tell when to drop it
+    std::uint64_t local_generation() const {
+        return local_generation_.load(std::memory_order_acquire);
     }
 
-    return tz;
+    const Zone& zone(ZoneId id) const {
+        const auto* chunk = chunks_[id / kZoneChunkSize].load(std::memory_order_acquire);
+        return chunk[id % kZoneChunkSize];
+    }
+
+    std::size_t size() const { return size_.load(std::memory_order_acquire); }
+
+   private:
+    struct Slot {
+        std::uint64_t hash;
+        ZoneId id;
+    };
+
+    struct Index {
+        std::vector<Slot> slots;
+        std::uint64_t mask;
+        std::size_t size;
+    };
+
+    // A local zone registered so far, by the name it was resolved to and its contents
+    struct LocalZone {
+        std::string name;
+        std::uint64_t hash;
+        ZoneId id;
+    };
+
+    ZoneRegistry()
+            : local_(kNoZoneId),
+              local_checked_(std::numeric_limits<std::int64_t>::min()),
+              local_generation_(0),
+              size_(0) {
+        for (auto& chunk : chunks_) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
+        // Before the registry loads any zone
+        next_zone_info_source_factory() = cctz_extension::zone_info_source_factory;
+        cctz_extension::zone_info_source_factory = local_zone_info_source;
+
+        for (auto* target : {&index_, &fixed_index_}) {
+            std::unique_ptr<Index> index(new Index{std::vector<Slot>(16, {0, kNoZoneId}), 15, 0});
+            target->store(index.get(), std::memory_order_release);
+            indexes_.push_back(std::move(index));
+        }
+
+        insert("UTC", cctz::utc_time_zone(), TransitionTable());
+
+        for (std::size_t i = 0; i < kPooledOffsets; ++i) {
+            const auto offset = static_cast<std::int32_t>(i) * kPooledOffsetStep;
+            const auto& tz = cctz::fixed_time_zone(cctz::seconds(offset - kMaxPooledOffset));
+            pooled_[i] = insert(tz.name(), tz, TransitionTable(tz));
+        }
+    }
+
+    ZoneId insert(string_view name, const cctz::time_zone& tz, TransitionTable&& table) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Another thread may have registered the same zone while this one was loading it
+        const auto found = find(name);
+
+        if (found) {
+            return *found;
+        }
+
+        const auto id = append(name, tz, std::move(table));
+        publish(&index_, Slot{hash_name(name), id});
+
+        return id;
+    }
+
+    ZoneId insert_fixed(std::int32_t seconds) {
+        const auto& tz = cctz::fixed_time_zone(cctz::seconds(seconds));
+        TransitionTable table(tz);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto found = find_fixed(seconds);
+
+        if (found) {
+            return *found;
+        }
+
+        // The same zone may be registered by name already, e.g. UTC for out of range offsets
+        const auto& name = tz.name();
+        found = find(name);
+
+        auto id = kNoZoneId;
+
+        if (found) {
+            id = *found;
+        } else {
+            id = append(name, tz, std::move(table));
+            publish(&index_, Slot{hash_name(name), id});
+        }
+
+        publish(&fixed_index_, Slot{hash_offset(seconds), id});
+
+        return id;
+    }
+
+    ZoneId append(string_view name, const cctz::time_zone& tz, TransitionTable&& table) {
+        const auto id = static_cast<ZoneId>(size_.load(std::memory_order_relaxed));
+
+        if (id / kZoneChunkSize >= kMaxZoneChunks) {
+            raise(Error(kInvalidTimezone, "too many timezones: ", name));
+        }
+
+        auto& chunk = chunks_[id / kZoneChunkSize];
+
+        if (chunk.load(std::memory_order_relaxed) == nullptr) {
+            chunks_owner_.emplace_back(new Zone[kZoneChunkSize]);
+            chunk.store(chunks_owner_.back().get(), std::memory_order_release);
+        }
+
+        auto& zone = chunk.load(std::memory_order_relaxed)[id % kZoneChunkSize];
+        zone.name.assign(name.data(), name.size());
+        zone.tz = tz;
+        zone.table = std::move(table);
+
+        size_.store(id + 1, std::memory_order_release);
+
+        return id;
+    }
+
+    ZoneId refresh_local(std::int64_t now) {
+        auto source = LocalZoneSource::current();
+
+        std::lock_guard<std::mutex> lock(local_mutex_);
+
+        // Another thread may have checked while this one was waiting
+        if (is_fresh(now, local_checked_.load(std::memory_order_relaxed))) {
+            return local_.load(std::memory_order_acquire);
+        }
+
+        auto id = local_.load(std::memory_order_acquire);
+
+        if (id == kNoZoneId || source != local_source_) {
+            const auto hash = hash_file(source.path);
+            id = kNoZoneId;
+            auto loaded = false;
+
+            for (const auto& zone : local_zones_) {
+                if (zone.name == source.name) {
+                    loaded = true;
+
+                    if (zone.hash == hash) {
+                        id = zone.id;
+                    }
+                }
+            }
+
+            if (id == kNoZoneId) {
+                id = load_local(source.name, hash, loaded);
+            }
+
+            local_source_ = std::move(source);
+            local_.store(id, std::memory_order_release);
+        }
+
+        local_checked_.store(now, std::memory_order_release);
+
+        return id;
+    }
+
+    // Registers the local zone of the name and contents. A name loaded before with other
+    // contents is loaded under a key which cctz has not cached.
+    ZoneId load_local(const std::string& name, std::uint64_t hash, bool loaded) {
+        const auto key = loaded ? kLocalZoneKeyPrefix + std::to_string(hash) + ":" + name : name;
+        cctz::time_zone tz;
+
+        // Like cctz::local_time_zone(), fall back to UTC if the zone cannot be loaded
+        if (!cctz::load_time_zone(key, &tz)) {
+            tz = cctz::utc_time_zone();
+        }
+
+        TransitionTable table(tz);
+        auto id = kNoZoneId;
+
+        {
+            std::lock_guard<std::mutex> append_lock(mutex_);
+            id = append("local", tz, std::move(table));
+        }
+
+        local_zones_.push_back(LocalZone{name, hash, id});
+
+        return id;
+    }
+
+    static std::uint64_t hash_file(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        const std::string contents((std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>());
+
+        return hash_name(contents);
+    }
+
+    static bool is_fresh(std::int64_t now, std::int64_t checked) {
+        return static_cast<std::uint64_t>(now) - static_cast<std::uint64_t>(checked) <
+               kLocalZoneCheckInterval;
+    }
+
+    // Builds a new index containing the slot and swaps it in. Older indexes are kept alive since
+    // readers may still be probing them.
+    void publish(std::atomic<const Index*>* target, const Slot& slot) {
+        const auto* current = target->load(std::memory_order_relaxed);
+        auto capacity = current->slots.size();
+
+        if ((current->size + 1) * 2 > capacity) {
+            capacity *= 2;
+        }
+
+        std::unique_ptr<Index> index(
+                new Index{std::vector<Slot>(capacity, Slot{0, kNoZoneId}), capacity - 1, 0});
+
+        for (const auto& s : current->slots) {
+            if (s.id != kNoZoneId) {
+                place(index.get(), s);
+            }
+        }
+
+        place(index.get(), slot);
+
+        target->store(index.get(), std::memory_order_release);
+        indexes_.push_back(std::move(index));
+    }
+
+    static void place(Index* index, const Slot& slot) {
+        auto i = slot.hash & index->mask;
+
+        while (index->slots[i].id != kNoZoneId) {
+            i = (i + 1) & index->mask;
+        }
+
+        index->slots[i] = slot;
+        ++index->size;
+    }
+
+    // FNV-1a
+    static std::uint64_t hash_name(string_view name) {
+        std::uint64_t hash = 14695981039346656037ULL;
+
+        for (const auto c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    // Invertible, so equal hashes mean equal offsets
+    static std::uint64_t hash_offset(std::int32_t seconds) {
+        return hash_mix(static_cast<std::uint64_t>(static_cast<std::int64_t>(seconds)));
+    }
+
+    std::mutex mutex_;
+    std::mutex local_mutex_;
+    std::atomic<Zone*> chunks_[kMaxZoneChunks];
+    std::vector<std::unique_ptr<Zone[]>> chunks_owner_;
+    std::atomic<const Index*> index_;
+    std::atomic<const Index*> fixed_index_;
+    std::vector<std::unique_ptr<Index>> indexes_;
+    ZoneId pooled_[kPooledOffsets];
+    LocalZoneSource local_source_;
+    std::vector<LocalZone> local_zones_;
+    std::atomic<ZoneId> local_;
+    std::atomic<std::int64_t> local_checked_;
+    std::atomic<std::uint64_t> local_generation_;
+    std::atomic<std::size_t> size_;
+};
+
+inline Expected<ZoneId> try_zone_id(string_view name) {
+    auto& registry = ZoneRegistry::instance();
+
+    if (name == string_view("local")) {
+        return registry.local();
+    }
+
+    const auto id = registry.load(name);
+
+    if (!id) {
+        return Error(kInvalidTimezone, "tz: ", name);
+    }
+
+    return *id;
+}
+
+inline ZoneId zone_id(string_view name) { return try_zone_id(name).value(); }
+
+inline const Zone& zone(ZoneId id) { return ZoneRegistry::instance().zone(id); }
+inline const cctz::time_zone& timezone(ZoneId id) { return zone(id).tz; }
+
+inline cctz::time_zone timezone(string_view name) { return timezone(zone_id(name)); }
+
+inline ZoneId zone_id(std::chrono::seconds offset) {
+    return ZoneRegistry::instance().fixed(static_cast<std::int32_t>(offset.count()));
 }
 
-inline cctz::time_zone timezone(std::chrono::seconds offset) {
-    return cctz::fixed_time_zone(offset);
+inline const cctz::time_zone& timezone(std::chrono::seconds offset) {
+    return timezone(zone_id(offset));
 }
 
 }  // namespace internal
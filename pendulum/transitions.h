@@ -0,0 +1,263 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_TRANSITIONS_H_
+#define PENDULUM_TRANSITIONS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include "pendulum/calendar.h"
+
+namespace pendulum {
+namespace internal {
+
+// Transitions at or after 2100-01-01T00:00:00Z are not compiled into tables
+constexpr std::int64_t kTransitionHorizon = 4102444800;
+constexpr std::size_t kMaxTransitions = 4096;
+
+struct TransitionInfo {
+    std::int32_t offset;
+    std::int32_t is_dst;
+};
+
+// UTC instants [begin, end) which share the same offset
+struct TransitionSpan {
+    std::int64_t begin;
+    std::int64_t end;
+    TransitionInfo info;
+};
+
+inline std::int64_t to_seconds(const cctz::civil_second& cs) {
+    return days_from_civil(cs.year(), cs.month(), cs.day()) * 86400 + cs.hour() * 3600 +
+           cs.minute() * 60 + cs.second();
+}
+
+inline cctz::civil_second to_civil(std::int64_t seconds) {
+    auto days = seconds / 86400;
+    auto sod = seconds % 86400;
+
+    if (sod < 0) {
+        --days;
+        sod += 86400;
+    }
+
+    const auto cd = civil_from_days(days);
+
+    return cctz::civil_second(cd.year, cd.month, cd.day, sod / 3600, sod / 60 % 60, sod % 60);
+}
+
+// Flattened transition table of a timezone.
+//
+// instants_ holds the UTC instants of the transitions and civil_ holds their civil-time mirror,
+// i.e. the first local time that resolves to the post-transition offset, so both directions are
+// answered by the same branchless binary search over a contiguous array. infos_[0] describes the
+// time before the first transition and infos_[i + 1] the time after instants_[i]. Instants past
+// the compiled horizon go back to cctz.
+class TransitionTable {
+   public:
+    TransitionTable()
+            : infos_{TransitionInfo{0, 0}},
+              upper_(std::numeric_limits<std::int64_t>::max()),
+              civil_upper_(std::numeric_limits<std::int64_t>::max()) {}
+
+    explicit TransitionTable(const cctz::time_zone& tz)
+            : tz_(tz),
+              upper_(std::numeric_limits<std::int64_t>::max()),
+              civil_upper_(std::numeric_limits<std::int64_t>::max()) {
+        using seconds_point = cctz::time_point<cctz::seconds>;
+
+        cctz::time_zone::civil_transition trans;
+        auto tp = seconds_point::min();
+
+        while (tz.next_transition(tp, &trans)) {
+            tp = tz.lookup(trans.to).trans;
+            const auto instant = static_cast<std::int64_t>(tp.time_since_epoch().count());
+            const auto& al = tz.lookup(tp);
+
+            if (instants_.empty()) {
+                const auto& before = tz.lookup(tp - cctz::seconds(1));
+                infos_.push_back(TransitionInfo{before.offset, before.is_dst});
+            }
+
+            const auto previous = infos_.back().offset;
+
+            if (instant >= kTransitionHorizon || instants_.size() >= kMaxTransitions) {
+                upper_ = instant;
+                civil_upper_ = instant + std::min(previous, al.offset);
+                break;
+            }
+
+            instants_.push_back(instant);
+            civil_.push_back(instant + std::max(previous, al.offset));
+            infos_.push_back(TransitionInfo{al.offset, al.is_dst});
+        }
+
+        if (infos_.empty()) {
+            const auto& al = tz.lookup(seconds_point());
+            infos_.push_back(TransitionInfo{al.offset, al.is_dst});
+        }
+
+        // Transitions are months apart in practice, but refuse to search a mirror that is not
+        // sorted and let cctz resolve civil times instead.
+        for (std::size_t i = 1; i < civil_.size(); ++i) {
+            if (civil_[i - 1] > civil_[i]) {
+                civil_upper_ = std::numeric_limits<std::int64_t>::min();
+                break;
+            }
+        }
+    }
+
+    TransitionTable(const TransitionTable&) = default;
+    TransitionTable(TransitionTable&&) = default;
+
+    ~TransitionTable() = default;
+
+    TransitionTable& operator=(const TransitionTable&) = default;
+    TransitionTable& operator=(TransitionTable&&) = default;
+
+    // Offset and DST flag in effect at the UTC instant
+    TransitionInfo lookup(std::int64_t instant) const {
+        if (instant >= upper_) {
+            const auto& al = tz_.lookup(cctz::time_point<cctz::seconds>(cctz::seconds(instant)));
+            return TransitionInfo{al.offset, al.is_dst};
+        }
+
+        // The current era, after the last transition, needs no search
+        if (instants_.empty() || instant >= instants_.back()) {
+            return infos_.back();
+        }
+
+        return infos_[count_until(instants_, instant)];
+    }
+
+    // Span of the offset in effect at the UTC instant. Past the compiled horizon the span only
+    // covers the instant itself.
+    TransitionSpan span(std::int64_t instant) const {
+        if (instant >= upper_) {
+            return TransitionSpan{instant, instant + 1, lookup(instant)};
+        }
+
+        if (instants_.empty() || instant >= instants_.back()) {
+            const auto begin = instants_.empty() ? std::numeric_limits<std::int64_t>::min()
+                                                 : instants_.back();
+            return TransitionSpan{begin, upper_, infos_.back()};
+        }
+
+        const auto i = count_until(instants_, instant);
+        const auto begin = i == 0 ? std::numeric_limits<std::int64_t>::min() : instants_[i - 1];
+
+        return TransitionSpan{begin, instants_[i], infos_[i]};
+    }
+
+    // UTC instant of the local (civil) time, following cctz::convert(): repeated times resolve
+    // with the pre-transition offset and skipped times to the transition itself
+    std::int64_t to_instant(std::int64_t local) const {
+        std::int32_t offset = 0;
+        return to_instant(local, &offset);
+    }
+
+    // Same as above, also storing the offset in effect at the resulting instant
+    std::int64_t to_instant(std::int64_t local, std::int32_t* offset) const {
+        if (local >= civil_upper_) {
+            const auto& tp = cctz::convert(to_civil(local), tz_);
+            *offset = tz_.lookup(tp).offset;
+            return static_cast<std::int64_t>(tp.time_since_epoch().count());
+        }
+
+        if (civil_.empty() || local >= civil_.back()) {
+            *offset = infos_.back().offset;
+            return local - *offset;
+        }
+
+        // Only a skipped time can land past the next transition with the pre-transition offset
+        const auto i = count_until(civil_, local);
+        const auto instant = local - infos_[i].offset;
+
+        if (instant >= instants_[i]) {
+            *offset = infos_[i + 1].offset;
+            return instants_[i];
+        }
+
+        *offset = infos_[i].offset;
+        return instant;
+    }
+
+    // Same as to_instant() but skipped times also resolve with the pre-transition offset, following
+    // cctz::parse()
+    std::int64_t to_instant_pre(std::int64_t local) const {
+        if (local >= civil_upper_) {
+            const auto& tp = tz_.lookup(to_civil(local)).pre;
+            return static_cast<std::int64_t>(tp.time_since_epoch().count());
+        }
+
+        if (civil_.empty() || local >= civil_.back()) {
+            return local - infos_.back().offset;
+        }
+
+        return local - infos_[count_until(civil_, local)].offset;
+    }
+
+    // Local (civil) time of the UTC instant
+    std::int64_t to_local(std::int64_t instant) const { return instant + lookup(instant).offset; }
+
+    const std::vector<std::int64_t>& instants() const { return instants_; }
+
+    std::size_t memory_usage() const {
+        return sizeof(*this) + instants_.capacity() * sizeof(std::int64_t) +
+               civil_.capacity() * sizeof(std::int64_t) +
+               infos_.capacity() * sizeof(TransitionInfo);
+    }
+
+   private:
+    // Number of elements in the sorted array which are less than or equal to the value
+    static std::size_t count_until(const std::vector<std::int64_t>& v, std::int64_t value) {
+        const auto* base = v.data();
+        auto n = v.size();
+
+        while (n > 1) {
+            const auto half = n / 2;
+            base = (base[half] <= value) ? base + half : base;
+            n -= half;
+        }
+
+        return static_cast<std::size_t>(base - v.data()) + (*base <= value ? 1 : 0);
+    }
+
+    cctz::time_zone tz_;
+    std::vector<std::int64_t> instants_;
+    std::vector<std::int64_t> civil_;
+    std::vector<TransitionInfo> infos_;
+    std::int64_t upper_;
+    std::int64_t civil_upper_;
+};
+
+}  // namespace internal
+}  // namespace pendulum
+
+#endif  // PENDULUM_TRANSITIONS_H_
@@ -0,0 +1,124 @@
+// MIT License
+//
+// Copyright (c) 2026 IDA Kenichiro
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PENDULUM_TZDATA_H_
+#define PENDULUM_TZDATA_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <cctz/zone_info_source.h>
+
+#include "pendulum/internal.h"
+
+namespace pendulum {
+namespace internal {
+
+// Compiled tzdata (TZif) of a zone embedded into the binary
+struct EmbeddedZone {
+    const char* name;
+    const unsigned char* data;
+    std::size_t size;
+};
+
+struct EmbeddedTzdata {
+    const EmbeddedZone* zones;  // sorted by name
+    std::size_t size;
+    const char* version;
+};
+
+// Defined by the source that cmake/EmbedTzdata.cmake generates for the pendulum_tzdata target,
+// which also defines PENDULUM_EMBEDDED_TZDATA for its users
+const EmbeddedTzdata& embedded_tzdata();
+
+inline const EmbeddedZone* find_embedded_zone(const EmbeddedTzdata& tzdata, string_view name) {
+    const auto* first = tzdata.zones;
+    const auto* last = tzdata.zones + tzdata.size;
+    const auto* it = std::lower_bound(first, last, name, [](const EmbeddedZone& zone,
+                                                            string_view value) {
+        return string_view(zone.name) < value;
+    });
+
+    if (it == last || string_view(it->name) != name) {
+        return nullptr;
+    }
+
+    return it;
+}
+
+class EmbeddedZoneInfoSource : public cctz::ZoneInfoSource {
+   public:
+    EmbeddedZoneInfoSource(const EmbeddedZone& zone, const char* version)
+            : zone_(zone), version_(version), position_(0) {}
+
+    std::size_t Read(void* ptr, std::size_t size) override {
+        size = std::min(size, zone_.size - position_);
+        std::memcpy(ptr, zone_.data + position_, size);
+        position_ += size;
+
+        return size;
+    }
+
+    int Skip(std::size_t offset) override {
+        if (offset > zone_.size - position_) {
+            position_ = zone_.size;
+            return -1;
+        }
+
+        position_ += offset;
+        return 0;
+    }
+
+    std::string Version() const override { return version_; }
+
+   private:
+    EmbeddedZone zone_;
+    const char* version_;
+    std::size_t position_;
+};
+
+using ZoneInfoSourceFallback =
+        std::function<std::unique_ptr<cctz::ZoneInfoSource>(const std::string&)>;
+
+// Factory for cctz_extension::zone_info_source_factory which serves embedded zones first and
+// reads ${TZDIR} only for zones that were not embedded
+inline std::unique_ptr<cctz::ZoneInfoSource> embedded_zone_info_source(
+        const std::string& name, const ZoneInfoSourceFallback& fallback) {
+    const auto& tzdata = embedded_tzdata();
+    const auto* zone = find_embedded_zone(tzdata, name);
+
+    if (zone != nullptr) {
+        return std::unique_ptr<cctz::ZoneInfoSource>(
+                new EmbeddedZoneInfoSource(*zone, tzdata.version));
+    }
+
+    return fallback(name);
+}
+
+}  // namespace internal
+}  // namespace pendulum
+
+#endif  // PENDULUM_TZDATA_H_
@@ -0,0 +1,191 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "pendulum/batch.h"
+#include "pendulum/format.h"
+#include "pendulum/helpers.h"
+
+namespace pendulum {
+
+namespace {
+
+void expect_converted(const std::vector<time_t>& timestamps, const char* tz) {
+    const auto& dts = from_timestamps(timestamps, tz);
+    const auto& columns = civil_columns(timestamps, tz);
+
+    ASSERT_THAT(dts.size(), timestamps.size());
+    ASSERT_THAT(columns.size(), timestamps.size());
+
+    for (std::size_t i = 0; i < timestamps.size(); ++i) {
+        const auto& want = from_timestamp(timestamps[i], tz);
+
+        EXPECT_THAT(dts[i], want) << tz << " " << timestamps[i];
+        EXPECT_THAT(dts[i].timezone_name(), want.timezone_name());
+        EXPECT_THAT(columns.year[i], want.year()) << tz << " " << timestamps[i];
+        EXPECT_THAT(columns.month[i], want.month()) << tz << " " << timestamps[i];
+        EXPECT_THAT(columns.day[i], want.day()) << tz << " " << timestamps[i];
+        EXPECT_THAT(columns.hour[i], want.hour()) << tz << " " << timestamps[i];
+        EXPECT_THAT(columns.minute[i], want.minute()) << tz << " " << timestamps[i];
+        EXPECT_THAT(columns.second[i], want.second()) << tz << " " << timestamps[i];
+    }
+}
+
+const std::vector<std::string> kPatterns = {
+        "%Y-%m-%dT%H:%M:%S%Ez", "[%d/%m/%Y:%T %z]", "%H:%M %F|%E*S", "%e %j %y %E3S %E*z",
+        "%a %b %d %T %Z",       "%T",               "",
+};
+
+void expect_formatted(const std::vector<time_t>& timestamps, const char* tz) {
+    for (const auto& pattern : kPatterns) {
+        const Format format(pattern);
+        StringColumn column;
+        format_many(timestamps, format, &column, tz);
+
+        ASSERT_THAT(column.size(), timestamps.size());
+        EXPECT_THAT(column.offsets.back(), column.data.size());
+
+        for (std::size_t i = 0; i < timestamps.size(); ++i) {
+            EXPECT_THAT(std::string(column[i]), from_timestamp(timestamps[i], tz).format(format))
+                    << pattern << " " << tz << " " << timestamps[i];
+        }
+    }
+}
+
+}  // namespace
+
+TEST(Batch, Sorted) {
+    // Crosses the DST transitions of 2020 in both hemispheres
+    std::vector<time_t> timestamps;
+    for (time_t t = 1583020800; t < 1606780800; t += 599) {
+        timestamps.push_back(t);
+    }
+
+    for (const auto* tz : {"UTC", "America/New_York", "Australia/Lord_Howe", "Asia/Kolkata"}) {
+        expect_converted(timestamps, tz);
+        expect_formatted(timestamps, tz);
+    }
+}
+
+TEST(Batch, Unsorted) {
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<time_t> dist(-3000000000LL, 5000000000LL);
+
+    std::vector<time_t> timestamps;
+    for (int i = 0; i < 5000; ++i) {
+        timestamps.push_back(dist(engine));
+    }
+
+    for (const auto* tz : {"UTC", "Europe/London", "America/Sao_Paulo"}) {
+        expect_converted(timestamps, tz);
+        expect_formatted(timestamps, tz);
+    }
+}
+
+TEST(Batch, Transition) {
+    // 2020-11-01T01:59:59-04:00 and the repeated hour after it
+    std::vector<time_t> timestamps;
+    for (time_t t = 1604210399 - 2; t < 1604210399 + 3600 + 3; ++t) {
+        timestamps.push_back(t);
+    }
+
+    expect_converted(timestamps, "America/New_York");
+    expect_converted({}, "America/New_York");
+    expect_formatted(timestamps, "America/New_York");
+    expect_formatted({}, "America/New_York");
+}
+
+TEST(Batch, FormatZones) {
+    const std::vector<internal::ZoneId> zones = {internal::zone_id("UTC"),
+                                                 internal::zone_id("Asia/Kolkata"),
+                                                 internal::zone_id("America/St_Johns")};
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<std::size_t> zone(0, zones.size() - 1);
+
+    std::vector<time_t> timestamps;
+    std::vector<internal::ZoneId> row_zones;
+
+    for (time_t t = 1583020800; t < 1606780800; t += 599) {
+        timestamps.push_back(t);
+        row_zones.push_back(zones[zone(engine)]);
+    }
+
+    const Format format("%FT%T%Ez");
+    StringColumn column;
+    format_many(timestamps, row_zones, format, &column);
+
+    ASSERT_THAT(column.size(), timestamps.size());
+
+    for (std::size_t i = 0; i < timestamps.size(); ++i) {
+        EXPECT_THAT(std::string(column[i]),
+                    DateTime::from_instant(timestamps[i], row_zones[i]).format(format));
+    }
+}
+
+TEST(Batch, FormatTimePoints) {
+    using TimePoint = std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
+
+    const std::vector<TimePoint> time_points = {
+            TimePoint(std::chrono::nanoseconds(1585699200123456789)),
+            TimePoint(std::chrono::nanoseconds(1585699201000000000)),
+            TimePoint(std::chrono::nanoseconds(1585699201500000000)),
+            TimePoint(std::chrono::nanoseconds(-1)),
+    };
+
+    StringColumn column;
+    format_many(time_points, Format("%Y-%m-%dT%H:%M:%E*S%Ez"), &column, "Asia/Tokyo");
+
+    EXPECT_THAT(column.size(), 4);
+    EXPECT_THAT(column[0], "2020-04-01T09:00:00.123456789+09:00");
+    EXPECT_THAT(column[1], "2020-04-01T09:00:01+09:00");
+    EXPECT_THAT(column[2], "2020-04-01T09:00:01.5+09:00");
+    EXPECT_THAT(column[3], "1970-01-01T08:59:59.999999999+09:00");
+    EXPECT_THAT(column.offsets, testing::ElementsAre(0, 35, 60, 87, 122));
+}
+
+TEST(Batch, ValidityBitmap) {
+    ValidityBitmap bitmap;
+    bitmap.assign(130);
+
+    for (const auto i : {0, 63, 64, 129}) {
+        bitmap.set(i);
+    }
+
+    EXPECT_THAT(bitmap.size(), 130);
+    EXPECT_THAT(bitmap.count(), 4);
+    EXPECT_TRUE(bitmap[63]);
+    EXPECT_FALSE(bitmap[62]);
+    EXPECT_THAT(bitmap.words(), testing::ElementsAre(0x8000000000000001, 1, 2));
+
+    bitmap.assign(1);
+    EXPECT_THAT(bitmap.count(), 0);
+}
+
+}  // namespace pendulum
@@ -0,0 +1,113 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <string>
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include "pendulum/calendar.h"
+
+namespace pendulum {
+namespace internal {
+
+static_assert(days_from_civil(1970, 1, 1) == 0, "epoch");
+static_assert(days_from_civil(2000, 2, 29) == 11016, "leap day");
+static_assert(civil_from_days(-1).year == 1969 && civil_from_days(-1).day == 31, "before epoch");
+static_assert(weekday(2020, 4, 17) == kFriday, "weekday");
+static_assert(iso_week(2021, 1, 3) == 53, "last ISO week of the previous year");
+static_assert(days_in_month(2100, 2) == 28, "not a leap year");
+static_assert(add_months(2020, 1, 31, 1).day == 29, "clamped to the end of February");
+
+TEST(Calendar, CivilFromDays) {
+    const auto epoch = civil_from_days(0);
+    EXPECT_THAT(epoch.year, 1970);
+    EXPECT_THAT(epoch.month, 1);
+    EXPECT_THAT(epoch.day, 1);
+
+    const auto leap_day = civil_from_days(11016);
+    EXPECT_THAT(leap_day.year, 2000);
+    EXPECT_THAT(leap_day.month, 2);
+    EXPECT_THAT(leap_day.day, 29);
+
+    const auto bc = civil_from_days(days_from_civil(-1, 3, 1));
+    EXPECT_THAT(bc.year, -1);
+    EXPECT_THAT(bc.month, 3);
+    EXPECT_THAT(bc.day, 1);
+}
+
+TEST(Calendar, MatchesCctz) {
+    const auto& utc = cctz::utc_time_zone();
+    const cctz::civil_day first(1890, 1, 1);
+    const cctz::civil_day last(2110, 12, 31);
+
+    for (auto cd = first; cd <= last; ++cd) {
+        const auto days = days_from_civil(cd.year(), cd.month(), cd.day());
+        const auto civil = civil_from_days(days);
+
+        ASSERT_THAT(days, cd - cctz::civil_day(1970, 1, 1));
+        ASSERT_THAT(civil.year, cd.year());
+        ASSERT_THAT(civil.month, cd.month());
+        ASSERT_THAT(civil.day, cd.day());
+        ASSERT_THAT(day_of_year(cd.year(), cd.month(), cd.day()), cctz::get_yearday(cd));
+        ASSERT_THAT(static_cast<int>(weekday_from_days(days)),
+                    (static_cast<int>(cctz::get_weekday(cd)) + 1) % 7);
+
+        if (cd.day() == 1 || cd.month() == 1 || cd.month() == 12) {
+            const auto week = cctz::format("%V", cctz::convert(cctz::civil_second(cd), utc), utc);
+            ASSERT_THAT(iso_week(cd.year(), cd.month(), cd.day()), std::stoi(week)) << cd;
+        }
+    }
+}
+
+TEST(Calendar, AddMonths) {
+    const auto next = add_months(2020, 12, 31, 2);
+    EXPECT_THAT(next.year, 2021);
+    EXPECT_THAT(next.month, 2);
+    EXPECT_THAT(next.day, 28);
+
+    const auto previous = add_months(2020, 3, 15, -15);
+    EXPECT_THAT(previous.year, 2018);
+    EXPECT_THAT(previous.month, 12);
+    EXPECT_THAT(previous.day, 15);
+
+    const auto leap = add_months(2019, 2, 28, 12);
+    EXPECT_THAT(leap.year, 2020);
+    EXPECT_THAT(leap.month, 2);
+    EXPECT_THAT(leap.day, 28);
+}
+
+TEST(Calendar, DaysInMonth) {
+    EXPECT_THAT(days_in_month(2020, 2), 29);
+    EXPECT_THAT(days_in_month(1900, 2), 28);
+    EXPECT_THAT(days_in_month(2000, 2), 29);
+    EXPECT_THAT(days_in_month(2020, 4), 30);
+    EXPECT_THAT(days_in_month(2020, 12), 31);
+    EXPECT_THAT(days_in_year(2020), 366);
+    EXPECT_THAT(iso_weeks_in_year(2020), 53);
+    EXPECT_THAT(iso_weeks_in_year(2021), 52);
+}
+
+}  // namespace internal
+}  // namespace pendulum
@@ -0,0 +1,197 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "pendulum/clock.h"
+#include "pendulum/helpers.h"
+
+namespace pendulum {
+
+TEST(Clock, Now) {
+    for (const auto* tz : {"UTC", "Asia/Tokyo", "America/New_York", "Asia/Tokyo"}) {
+        const auto before = std::chrono::system_clock::now();
+        const auto dt = now(tz);
+        const auto after = std::chrono::system_clock::now();
+
+        EXPECT_THAT(dt.timezone(), internal::timezone(tz));
+        EXPECT_THAT(dt.offset(), from_timestamp(dt.timestamp(), tz).offset());
+        EXPECT_THAT(dt.time_point<std::chrono::nanoseconds>(), testing::Ge(before));
+        EXPECT_THAT(dt.time_point<std::chrono::nanoseconds>(), testing::Le(after));
+    }
+}
+
+TEST(Clock, FastNow) {
+    const auto precise = now("Europe/Paris");
+    const auto coarse = fast_now("Europe/Paris");
+
+    EXPECT_THAT(coarse.timezone_name(), "Europe/Paris");
+    EXPECT_THAT(std::abs(coarse.timestamp() - precise.timestamp()), testing::Le(1));
+}
+
+TEST(Clock, Today) {
+    for (const auto* tz : {"Asia/Tokyo", "America/Los_Angeles"}) {
+        const auto start = now(tz).start_of(Unit::kDay);
+        const auto dt = today(tz);
+
+        // Unless midnight passed in between
+        if (dt == start) {
+            EXPECT_THAT(tomorrow(tz), start.add_days(1));
+            EXPECT_THAT(yesterday(tz), start.add_days(-1));
+        }
+
+        EXPECT_THAT(dt.timezone_name(), tz);
+        EXPECT_THAT(dt.hour(), 0);
+    }
+}
+
+TEST(Clock, InvalidTimezone) {
+    EXPECT_THROW(now("invalid"), InvalidTimezone);
+    EXPECT_THROW(today("invalid"), InvalidTimezone);
+    EXPECT_THAT(now("UTC").timezone_name(), "UTC");
+    EXPECT_THROW(now("invalid"), InvalidTimezone);
+}
+
+TEST(Clock, Cache) {
+    auto& cache = internal::NowCache::instance();
+
+    // 2020-11-01T05:59:59Z and 06:00:00Z, on both sides of the end of DST in New York
+    const internal::Timestamp edt{1604210399, 5};
+    const internal::Timestamp est{1604210400, 7};
+
+    EXPECT_THAT(cache.now(edt, "America/New_York").offset(), -4 * 3600);
+    EXPECT_THAT(cache.now(est, "America/New_York").offset(), -5 * 3600);
+    EXPECT_THAT(cache.now(est, "America/New_York").nanosecond(), 7);
+    EXPECT_THAT(cache.now(edt, "America/New_York").offset(), -4 * 3600);
+    EXPECT_THAT(cache.now(edt, "Asia/Tokyo").offset(), 9 * 3600);
+
+    EXPECT_THAT(cache.day(est.seconds, "America/New_York", 0),
+                DateTime(2020, 11, 1, "America/New_York"));
+    EXPECT_THAT(cache.day(est.seconds, "America/New_York", 1),
+                DateTime(2020, 11, 2, "America/New_York"));
+    EXPECT_THAT(cache.day(est.seconds + 86400, "America/New_York", -1),
+                DateTime(2020, 11, 1, "America/New_York"));
+}
+
+TEST(Clock, Threads) {
+    std::vector<std::thread> threads;
+    std::vector<int> offsets(4);
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([i, &offsets] {
+            const auto* tz = i % 2 == 0 ? "Asia/Tokyo" : "Asia/Kolkata";
+
+            for (int j = 0; j < 1000; ++j) {
+                offsets[i] = now(tz).offset();
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_THAT(offsets, testing::ElementsAre(32400, 19800, 32400, 19800));
+}
+
+TEST(Clock, Policy) {
+    const auto before = std::chrono::system_clock::now();
+
+    EXPECT_THAT(now<SystemClock>("UTC").time_point<std::chrono::nanoseconds>(),
+                testing::Ge(before));
+    EXPECT_THAT(now<std::chrono::system_clock>("UTC").time_point<std::chrono::nanoseconds>(),
+                testing::Ge(before));
+    EXPECT_THAT(std::abs(now<CoarseClock>("UTC").timestamp() - now("UTC").timestamp()),
+                testing::Le(1));
+    EXPECT_THAT(today<SystemClock>("Asia/Tokyo").hour(), 0);
+}
+
+TEST(Clock, TickClock) {
+    TickClock clock(DateTime(2020, 3, 7, 23, 59, 59, "UTC"), std::chrono::milliseconds(500));
+    ScopedClock scoped(clock);
+
+    EXPECT_THAT(now("Asia/Tokyo"), DateTime(2020, 3, 8, 8, 59, 59, "Asia/Tokyo"));
+    EXPECT_THAT(now("Asia/Tokyo").nanosecond(), 500000000);
+    EXPECT_THAT(now("Asia/Tokyo"), DateTime(2020, 3, 8, 9, 0, 0, "Asia/Tokyo"));
+    EXPECT_THAT(today("UTC"), DateTime(2020, 3, 8, "UTC"));
+    EXPECT_THAT(yesterday("UTC"), DateTime(2020, 3, 7, "UTC"));
+    EXPECT_THAT(tomorrow("America/New_York"), DateTime(2020, 3, 8, "America/New_York"));
+
+    clock.set(DateTime(2020, 3, 8, 6, 59, 59, "UTC"));
+    EXPECT_THAT(now("America/New_York").offset(), -5 * 3600);
+    clock.advance(std::chrono::seconds(1));
+    EXPECT_THAT(clock.peek(), DateTime(2020, 3, 8, 7, 0, 0).time_point<std::chrono::nanoseconds>() +
+                                  std::chrono::milliseconds(500));
+    EXPECT_THAT(now("America/New_York").offset(), -4 * 3600);
+}
+
+TEST(Clock, ScopedClock) {
+    TickClock outer(DateTime(2000, 1, 1), std::chrono::nanoseconds(0));
+    TickClock inner(DateTime(2010, 1, 1), std::chrono::nanoseconds(0));
+
+    {
+        ScopedClock a(outer);
+
+        {
+            ScopedClock b(inner);
+            EXPECT_THAT(now("UTC"), DateTime(2010, 1, 1));
+        }
+
+        EXPECT_THAT(now("UTC"), DateTime(2000, 1, 1));
+        EXPECT_THAT(fast_now("UTC"), DateTime(2000, 1, 1));
+    }
+
+    EXPECT_THAT(now("UTC").year(), testing::Ge(2020));
+}
+
+TEST(Clock, ThreadClocks) {
+    std::vector<std::thread> threads;
+    std::vector<DateTime> last(4);
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([i, &last] {
+            TickClock clock(DateTime(2000 + i, 1, 1), std::chrono::seconds(1));
+            ScopedClock scoped(clock);
+
+            for (int j = 0; j < 86400; ++j) {
+                last[i] = now("Europe/London");
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_THAT(last, testing::ElementsAre(DateTime(2000, 1, 1, 23, 59, 59),
+                                           DateTime(2001, 1, 1, 23, 59, 59),
+                                           DateTime(2002, 1, 1, 23, 59, 59),
+                                           DateTime(2003, 1, 1, 23, 59, 59)));
+    EXPECT_THAT(now("UTC").year(), testing::Ge(2020));
+}
+
+}  // namespace pendulum
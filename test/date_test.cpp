@@ -52,6 +52,39 @@ TEST(Date, InvalidDate) {
     EXPECT_THROW(Date(2020, 1, 0), InvalidDateTime);
 }
 
+TEST(Date, TryCreate) {
+    EXPECT_THAT(*Date::create(2020, 2, 29), Date(2020, 2, 29));
+
+    const auto date = Date::create(2020, 2, 30);
+
+    EXPECT_FALSE(date);
+    EXPECT_THAT(date.error().code(), kInvalidDateTime);
+    EXPECT_THAT(date.error().message(), "Invalid date: 2020-2-30");
+    EXPECT_THAT(date.value_or(Date()), Date());
+    EXPECT_THROW(date.value(), InvalidDateTime);
+}
+
+TEST(Date, TryStartOf) {
+    Date date(2020, 4, 17);
+
+    EXPECT_THAT(*date.try_start_of("month"), Date(2020, 4, 1));
+    EXPECT_THAT(*date.try_end_of("year"), Date(2020, 12, 31));
+    EXPECT_THAT(date.try_start_of("hour").error().code(), kInvalidUnit);
+    EXPECT_THAT(date.try_end_of("hour").error().message(), "unit for end_of(): hour");
+    EXPECT_THROW(date.start_of("hour"), InvalidUnit);
+}
+
+TEST(Date, StartOfUnit) {
+    Date date(2020, 4, 17);
+
+    EXPECT_THAT(date.start_of(Unit::kMonth), date.start_of("month"));
+    EXPECT_THAT(date.end_of(Unit::kWeek), date.end_of("week"));
+    EXPECT_THAT(date.start_of<Unit::kYear>(), Date(2020, 1, 1));
+    EXPECT_THAT(date.end_of<Unit::kDay>(), date);
+    EXPECT_THAT(date.try_start_of(Unit::kHour).error().message(), "unit for start_of(): hour");
+    EXPECT_THROW(date.end_of(Unit::kMinute), InvalidUnit);
+}
+
 TEST(Date, Attributes) {
     Date date(2020, 4, 17);
 
@@ -161,4 +194,12 @@ TEST(Date, UnorderedMap) {
     EXPECT_THAT(map[Date()], 1);
 }
 
+TEST(Date, Hash) {
+    const std::hash<Date> hash;
+
+    EXPECT_THAT(hash(Date(2020, 4, 3)), hash(Date(2020, 3, 31).add_days(3)));
+    EXPECT_THAT(hash(Date(2020, 4, 3)), testing::Ne(hash(Date(2020, 4, 4))));
+    EXPECT_THAT(hash(Date(1969, 12, 31)), testing::Ne(hash(Date())));
+}
+
 }  // namespace pendulum
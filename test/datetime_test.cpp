@@ -22,8 +22,11 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <chrono>
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 #include "pendulum/datetime.h"
 #include "pendulum/exceptions.h"
@@ -92,6 +95,78 @@ TEST(DateTime, InvalidDateTime) {
 
 TEST(DateTime, InvalidTimezone) { EXPECT_THROW(DateTime(2020, 4, 3, "invalid"), InvalidTimezone); }
 
+TEST(DateTime, TryCreate) {
+    EXPECT_THAT(*DateTime::create(2020, 4, 3, 15, 30, 10, "Asia/Tokyo"),
+                DateTime(2020, 4, 3, 15, 30, 10, "Asia/Tokyo"));
+    EXPECT_THAT(*try_datetime(2020, 4, 3), DateTime(2020, 4, 3));
+    EXPECT_THAT(*try_date(2020, 4, 3), Date(2020, 4, 3));
+
+    const auto invalid = try_datetime(2020, 1, 1, 25, 0, 0);
+
+    EXPECT_FALSE(invalid);
+    EXPECT_THAT(invalid.error().code(), kInvalidDateTime);
+    EXPECT_THAT(invalid.error().message(), "Invalid datetime: 2020-1-1 25:0:0");
+
+    const auto tz = try_datetime(2020, 4, 3, 0, 0, 0, "invalid");
+
+    EXPECT_FALSE(tz);
+    EXPECT_THAT(tz.error().code(), kInvalidTimezone);
+    EXPECT_THAT(tz.error().message(), "tz: invalid");
+    EXPECT_THROW(tz.value(), InvalidTimezone);
+}
+
+TEST(DateTime, TryStartOf) {
+    DateTime dt(2020, 4, 3, 15, 30, 10);
+
+    EXPECT_THAT(*dt.try_start_of("hour"), DateTime(2020, 4, 3, 15));
+    EXPECT_THAT(*dt.try_end_of("minute"), DateTime(2020, 4, 3, 15, 30, 59));
+    EXPECT_THAT(dt.try_start_of("century").error().code(), kInvalidUnit);
+    EXPECT_THAT(dt.try_start_of("century").error().message(), "unit for start_of(): century");
+    EXPECT_THROW(dt.end_of("century"), InvalidUnit);
+}
+
+TEST(DateTime, StartOfUnit) {
+    const auto dt = DateTime(2020, 4, 3, 15, 30, 10, "Asia/Tokyo").add_nanoseconds(500);
+
+    for (const auto* unit : {"year", "month", "week", "day", "hour", "minute", "second"}) {
+        const auto u = *internal::to_unit(unit, false);
+
+        EXPECT_THAT(dt.start_of(u), dt.start_of(unit));
+        EXPECT_THAT(dt.end_of(u), dt.end_of(unit));
+    }
+
+    EXPECT_THAT(dt.start_of<Unit::kHour>(), DateTime(2020, 4, 3, 15, 0, 0, "Asia/Tokyo"));
+    EXPECT_THAT(dt.end_of<Unit::kMonth>(), DateTime(2020, 4, 30, 23, 59, 59, "Asia/Tokyo"));
+    EXPECT_THAT(dt.start_of<Unit::kSecond>(), DateTime(2020, 4, 3, 15, 30, 10, "Asia/Tokyo"));
+}
+
+TEST(DateTime, StartOfAcrossTransitions) {
+    // Both DST transitions of 2020 in New York, and Lord Howe's 30 minute shift
+    for (const auto* tz : {"America/New_York", "Australia/Lord_Howe"}) {
+        for (time_t t : {1583650800, 1604210400, 1586012400, 1601739000}) {
+            for (time_t delta = -7200; delta <= 7200; delta += 599) {
+                const auto dt = from_timestamp(t + delta, tz);
+
+                EXPECT_THAT(dt.start_of(Unit::kHour), dt.at(dt.hour(), 0, 0));
+                EXPECT_THAT(dt.end_of(Unit::kHour), dt.at(dt.hour(), 59, 59));
+                EXPECT_THAT(dt.start_of(Unit::kMinute), dt.at(dt.hour(), dt.minute(), 0));
+                EXPECT_THAT(dt.start_of(Unit::kDay), dt.at(0, 0, 0));
+                EXPECT_THAT(dt.end_of(Unit::kDay), dt.at(23, 59, 59));
+            }
+        }
+    }
+}
+
+TEST(DateTime, AddUnit) {
+    DateTime dt(2020, 1, 31, 15, 30, 10);
+
+    EXPECT_THAT(dt.add(Unit::kMonth, 1), dt.add_months(1));
+    EXPECT_THAT(dt.add<Unit::kWeek>(2), dt.add_days(14));
+    EXPECT_THAT(dt.add<Unit::kSecond>(-70), dt.subtract_minutes(1).subtract_seconds(10));
+    EXPECT_THAT(dt.subtract(Unit::kYear, 1), DateTime(2019, 1, 31, 15, 30, 10));
+    EXPECT_THAT(dt.subtract<Unit::kHour>(16), DateTime(2020, 1, 30, 23, 30, 10));
+}
+
 TEST(DateTime, Attributes) {
     DateTime dt(2020, 4, 3, 15, 30, 10, "America/New_York");
 
@@ -290,6 +365,101 @@ TEST(DateTime, Modifiers) {
                 DateTime(2020, 4, 3, 14, 45, 0, "Australia/Eucla"));
 }
 
+TEST(DateTime, Compare) {
+    // The same instant in three zones, and the instants a second around it
+    const DateTime a(2020, 4, 3, 15, 0, 0, "UTC");
+    const DateTime b(2020, 4, 4, 0, 0, 0, "Asia/Tokyo");
+    const DateTime c(2020, 4, 3, 11, 0, 0, "America/New_York");
+
+    EXPECT_TRUE(a == b && b == c);
+    EXPECT_FALSE(a != c);
+    EXPECT_TRUE(a <= b && a >= b);
+    EXPECT_TRUE(c.add_seconds(-1) < a && a < c.add_seconds(1));
+    EXPECT_TRUE(b.add_seconds(1) > c);
+
+    std::vector<DateTime> dts = {b.add_seconds(1), a, c.add_seconds(-1), c, b};
+    std::sort(dts.begin(), dts.end());
+    dts.erase(std::unique(dts.begin(), dts.end()), dts.end());
+
+    EXPECT_THAT(dts, testing::ElementsAre(a.add_seconds(-1), a, a.add_seconds(1)));
+}
+
+TEST(DateTime, SubSecond) {
+    using namespace std::chrono;
+
+    const auto tp = system_clock::time_point(seconds(1585927810)) + microseconds(123456);
+    const auto& dt = from_time_point(tp, "Asia/Tokyo");
+
+    EXPECT_THAT(dt, DateTime(2020, 4, 4, 0, 30, 10, "Asia/Tokyo").add_microseconds(123456));
+    EXPECT_THAT(dt.second(), 10);
+    EXPECT_THAT(dt.microsecond(), 123456);
+    EXPECT_THAT(dt.nanosecond(), 123456000);
+    EXPECT_THAT(dt.timestamp(), 1585927810);
+
+    EXPECT_THAT(dt.time_point<microseconds>(), time_point_cast<microseconds>(tp));
+    EXPECT_THAT(dt.time_point<seconds>().time_since_epoch().count(), 1585927810);
+    EXPECT_THAT(dt.time_point<milliseconds>().time_since_epoch().count(), 1585927810123);
+
+    EXPECT_THAT(dt.to_iso8601_string(), "2020-04-04T00:30:10.123456+09:00");
+    EXPECT_THAT(dt.format("%H:%M:%E3S"), "00:30:10.123");
+    EXPECT_THAT(dt.format("%H:%M:%E6S"), "00:30:10.123456");
+    EXPECT_THAT(dt.format("%H:%M:%E9S"), "00:30:10.123456000");
+    EXPECT_THAT(dt.to_datetime_string(), "2020-04-04 00:30:10");
+
+    // Kept by conversions and arithmetic, reset by at() and start_of()
+    EXPECT_THAT(dt.in_timezone("UTC").nanosecond(), 123456000);
+    EXPECT_THAT(dt.add_days(1).nanosecond(), 123456000);
+    EXPECT_THAT(dt.hour(5).nanosecond(), 123456000);
+    EXPECT_THAT(dt.at(5, 0, 0).nanosecond(), 0);
+    EXPECT_THAT(dt.start_of("day").nanosecond(), 0);
+
+    EXPECT_THAT(dt.add_nanoseconds(876544000), DateTime(2020, 4, 4, 0, 30, 11, "Asia/Tokyo"));
+    EXPECT_THAT(dt.subtract_microseconds(123457).format("%E*S"), "09.999999");
+    EXPECT_THAT(dt.nanosecond(7).nanosecond(), 7);
+    EXPECT_THAT(dt.microsecond(1000001).format("%E*S"), "11.000001");
+
+    EXPECT_TRUE(dt > dt.subtract_nanoseconds(1));
+    EXPECT_TRUE(dt < dt.add_nanoseconds(1));
+    EXPECT_TRUE(dt != dt.nanosecond(0));
+    EXPECT_TRUE(dt == dt.in_timezone("America/New_York"));
+}
+
+TEST(DateTime, SubSecondBeforeEpoch) {
+    using namespace std::chrono;
+
+    const auto tp = system_clock::time_point(nanoseconds(-1));
+    const auto& dt = from_time_point(tp);
+
+    EXPECT_THAT(dt.timestamp(), -1);
+    EXPECT_THAT(dt.nanosecond(), 999999999);
+    EXPECT_THAT(dt.to_iso8601_string(), "1969-12-31T23:59:59.999999999+00:00");
+    EXPECT_THAT(dt.time_point<nanoseconds>(), tp);
+    EXPECT_THAT(dt.time_point<seconds>().time_since_epoch().count(), -1);
+}
+
+TEST(DateTime, LargeNanoseconds) {
+    using namespace std::chrono;
+
+    // More seconds than an int holds, in both directions
+    const auto epoch = DateTime(1970, 1, 1, 0, 0, 0, "UTC");
+
+    EXPECT_THAT(epoch.add_nanoseconds(nanoseconds::max().count()).to_iso8601_string(),
+                "2262-04-11T23:47:16.854775807+00:00");
+    EXPECT_THAT(epoch.add_nanoseconds(nanoseconds::min().count()).to_iso8601_string(),
+                "1677-09-21T00:12:43.145224192+00:00");
+    EXPECT_THAT(epoch.add_nanoseconds(duration_cast<nanoseconds>(hours(24 * 365 * 100)).count())
+                        .year(),
+                2069);
+
+    // The current nanoseconds are carried without overflowing
+    const auto dt = epoch.add_nanoseconds(999999999);
+
+    EXPECT_THAT(dt.add_nanoseconds(nanoseconds::max().count()).to_iso8601_string(),
+                "2262-04-11T23:47:17.854775806+00:00");
+    EXPECT_THAT(dt.subtract_nanoseconds(3000000000).to_iso8601_string(),
+                "1969-12-31T23:59:57.999999999+00:00");
+}
+
 TEST(DateTime, Map) {
     std::map<DateTime, int> map{
             {DateTime(), 1},
@@ -304,6 +474,20 @@ TEST(DateTime, UnorderedMap) {
     };
 
     EXPECT_THAT(map[DateTime()], 1);
+
+    // Equal instants in different zones are the same key
+    map[DateTime(2020, 4, 3, 15, 0, 0, "UTC")] = 2;
+    EXPECT_THAT(map[DateTime(2020, 4, 4, 0, 0, 0, "Asia/Tokyo")], 2);
+    EXPECT_THAT(map.count(DateTime(2020, 4, 3, 15, 0, 0, "UTC").add_nanoseconds(1)), 0u);
+}
+
+TEST(DateTime, Hash) {
+    const std::hash<DateTime> hash;
+    const DateTime dt(2020, 4, 3, 15, 0, 0, "UTC");
+
+    EXPECT_THAT(hash(dt), hash(dt.in_timezone("America/New_York")));
+    EXPECT_THAT(hash(dt), testing::Ne(hash(dt.add_seconds(1))));
+    EXPECT_THAT(hash(dt), testing::Ne(hash(dt.add_nanoseconds(1))));
 }
 
 }  // namespace pendulum
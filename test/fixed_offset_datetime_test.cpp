@@ -0,0 +1,131 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <map>
+#include <unordered_map>
+
+#include "pendulum/datetime.h"
+#include "pendulum/exceptions.h"
+#include "pendulum/fixed_offset_datetime.h"
+
+namespace pendulum {
+
+using IstDateTime = FixedOffsetDateTime<19800>;
+
+TEST(FixedOffsetDateTime, Instantiation) {
+    UtcDateTime dt;
+
+    EXPECT_THAT(dt.timestamp(), 0);
+    EXPECT_THAT(dt.year(), 1970);
+    EXPECT_THAT(dt.timezone_name(), "UTC");
+
+    IstDateTime ist(2020, 4, 3, 15, 30, 10);
+
+    EXPECT_THAT(ist.year(), 2020);
+    EXPECT_THAT(ist.month(), 4);
+    EXPECT_THAT(ist.day(), 3);
+    EXPECT_THAT(ist.hour(), 15);
+    EXPECT_THAT(ist.minute(), 30);
+    EXPECT_THAT(ist.second(), 10);
+    EXPECT_THAT(ist.timezone_name(), "Fixed/UTC+05:30:00");
+}
+
+TEST(FixedOffsetDateTime, InvalidDateTime) {
+    EXPECT_THROW(UtcDateTime(2020, 2, 30), InvalidDateTime);
+    EXPECT_THROW(UtcDateTime(2020, 1, 1, 24, 0, 0), InvalidDateTime);
+}
+
+TEST(FixedOffsetDateTime, Attributes) {
+    IstDateTime dt(2020, 4, 3, 15, 30, 10);
+
+    EXPECT_THAT(dt.date(), Date(2020, 4, 3));
+    EXPECT_THAT(dt.day_of_week(), kFriday);
+    EXPECT_THAT(dt.day_of_year(), 94);
+    EXPECT_FALSE(dt.is_dst());
+    EXPECT_FALSE(dt.is_utc());
+    EXPECT_TRUE(UtcDateTime().is_utc());
+
+    EXPECT_THAT(dt.offset(), 19800);
+    EXPECT_THAT(dt.offset_hours(), 5.5);
+    EXPECT_THAT(dt.timestamp(), DateTime(2020, 4, 3, 10, 0, 10).timestamp());
+
+    static_assert(IstDateTime().offset() == 19800, "offset must be a constant expression");
+}
+
+TEST(FixedOffsetDateTime, StringFormatting) {
+    IstDateTime dt(2020, 4, 3, 15, 10, 25);
+
+    EXPECT_THAT(dt.to_date_string(), "2020-04-03");
+    EXPECT_THAT(dt.to_time_string(), "15:10:25");
+    EXPECT_THAT(dt.to_datetime_string(), "2020-04-03 15:10:25");
+    EXPECT_THAT(dt.to_iso8601_string(), "2020-04-03T15:10:25+05:30");
+    EXPECT_THAT(UtcDateTime(2020, 4, 3).to_iso8601_string(), "2020-04-03T00:00:00+00:00");
+}
+
+TEST(FixedOffsetDateTime, Addition) {
+    UtcDateTime dt(2020, 1, 31, 15, 0, 0);
+
+    EXPECT_THAT(dt.add_years(1), UtcDateTime(2021, 1, 31, 15, 0, 0));
+    EXPECT_THAT(dt.add_months(1), UtcDateTime(2020, 2, 29, 15, 0, 0));
+    EXPECT_THAT(dt.add_days(30), UtcDateTime(2020, 3, 1, 15, 0, 0));
+    EXPECT_THAT(dt.add_hours(-24), UtcDateTime(2020, 1, 30, 15, 0, 0));
+    EXPECT_THAT(dt.add_minutes(90), UtcDateTime(2020, 1, 31, 16, 30, 0));
+    EXPECT_THAT(dt.subtract_seconds(1), UtcDateTime(2020, 1, 31, 14, 59, 59));
+}
+
+TEST(FixedOffsetDateTime, Conversion) {
+    const DateTime dt(2020, 4, 3, 15, 30, 10, "Asia/Tokyo");
+    const IstDateTime ist(dt);
+
+    EXPECT_THAT(ist, IstDateTime(2020, 4, 3, 12, 0, 10));
+    EXPECT_THAT(UtcDateTime(dt), UtcDateTime(2020, 4, 3, 6, 30, 10));
+
+    const DateTime back = ist;
+
+    EXPECT_THAT(back, dt);
+    EXPECT_THAT(back.offset(), 19800);
+    EXPECT_THAT(back.to_iso8601_string(), "2020-04-03T12:00:10+05:30");
+
+    // Comparisons with DateTime go through the implicit conversion
+    EXPECT_TRUE(ist == dt);
+    EXPECT_TRUE(UtcDateTime(2020, 4, 3, 6, 30, 11) > dt);
+}
+
+TEST(FixedOffsetDateTime, Map) {
+    std::map<UtcDateTime, int> map{
+            {UtcDateTime(), 1},
+    };
+
+    EXPECT_THAT(map[UtcDateTime()], 1);
+}
+
+TEST(FixedOffsetDateTime, UnorderedMap) {
+    std::unordered_map<UtcDateTime, int> map{
+            {UtcDateTime(), 1},
+    };
+
+    EXPECT_THAT(map[UtcDateTime()], 1);
+}
+
+}  // namespace pendulum
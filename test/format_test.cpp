@@ -0,0 +1,381 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cctz/time_zone.h>
+
+#include "pendulum/date.h"
+#include "pendulum/datetime.h"
+#include "pendulum/fixed_offset_datetime.h"
+#include "pendulum/format.h"
+#include "pendulum/parser.h"
+
+namespace pendulum {
+
+namespace {
+
+const std::vector<std::string> kPatterns = {
+        "%Y-%m-%dT%H:%M:%E*S%Ez",
+        "%Y-%m-%d %H:%M:%S",
+        "%Y%m%dT%H%M%S%z",
+        "[%d/%m/%Y:%T %z]",
+        "%F %R",
+        "%e.%m.%y %j %%",
+        "%H:%M:%E3S|%E9S|%E0S|%E*f|%E6f|%E0f",
+        "%E*z",
+        "%Y-%m-%d %H:%M:%E*S",
+        "%H:%M",
+        "",
+};
+
+std::string cctz_format(const std::string& pattern, const DateTime& dt) {
+    const auto tp = cctz::time_point<cctz::seconds>(cctz::seconds(dt.timestamp()));
+    const auto fs = cctz::detail::femtoseconds(std::int64_t{dt.nanosecond()} * 1000000);
+
+    return cctz::detail::format(pattern, tp, fs, internal::timezone(dt.timezone_name()));
+}
+
+std::vector<DateTime> random_datetimes(std::size_t n) {
+    const std::vector<internal::string_view> zones = {
+            "UTC", "America/St_Johns", "Europe/Amsterdam", "Asia/Kolkata", "America/New_York"};
+
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<std::int64_t> instants(-70000000000, 400000000000);
+    std::uniform_int_distribution<std::size_t> zone(0, zones.size() - 1);
+    std::uniform_int_distribution<int> nanos(0, 999999999);
+    std::uniform_int_distribution<int> digits(0, 9);
+
+    std::vector<DateTime> dts;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        // Fractions of every length, down to whole seconds
+        const auto scale = internal::kPowersOf10[digits(engine)];
+        const auto id = internal::zone_id(zones[zone(engine)]);
+
+        dts.push_back(DateTime::from_instant(instants(engine), id, nanos(engine) / scale * scale));
+    }
+
+    return dts;
+}
+
+}  // namespace
+
+TEST(Format, Compile) {
+    EXPECT_TRUE(Format("%Y-%m-%dT%H:%M:%E*S%Ez").formats_natively());
+    EXPECT_TRUE(Format("%Y-%m-%dT%H:%M:%E*S%Ez").parses_natively());
+    EXPECT_THAT(Format("%Y-%m-%dT%H:%M:%E*S%Ez").max_size(), 20 + 15 + 10 + 6);
+
+    // Formatted natively, parsed by cctz
+    EXPECT_TRUE(Format("%e %j %y %E3S %E*z").formats_natively());
+    EXPECT_FALSE(Format("%e %j %y %E3S %E*z").parses_natively());
+
+    // Neither
+    for (const auto* pattern : {"%a %b %d", "%Z", "%E12S", "%s", "%", "%E", "%Ex", "%Oy"}) {
+        EXPECT_FALSE(Format(pattern).formats_natively()) << pattern;
+        EXPECT_FALSE(Format(pattern).parses_natively()) << pattern;
+    }
+
+    EXPECT_TRUE(Format("%Y%m%d").is_ymd());
+    EXPECT_FALSE(Format("%Y%m%d").parses_natively());
+    EXPECT_THAT(Format("%F").fields().size(), 5U);
+    EXPECT_THAT(Format("%Y-%m-%d").pattern(), "%Y-%m-%d");
+}
+
+TEST(Format, Format) {
+    const auto dt = DateTime(2020, 4, 3, 22, 18, 26, "Asia/Tokyo").add_microseconds(1500);
+
+    EXPECT_THAT(dt.format(Format("%Y-%m-%dT%H:%M:%E*S%Ez")), "2020-04-03T22:18:26.0015+09:00");
+    EXPECT_THAT(dt.format(Format("at %H:%M:%S on %d/%m, %Y")), "at 22:18:26 on 03/04, 2020");
+    EXPECT_THAT(dt.format(Format("%a %d %b")), "Fri 03 Apr");
+    EXPECT_THAT(dt.format(Format("%Z")), "JST");
+    EXPECT_THAT(dt.format(Format("")), "");
+
+    EXPECT_THAT(Date(2020, 4, 3).format(Format("%d/%m/%Y %H:%M %z")), "03/04/2020 00:00 +0000");
+    EXPECT_THAT(FixedOffsetDateTime<-3600>(dt).format(Format("%FT%T%Ez")),
+                "2020-04-03T12:18:26-01:00");
+}
+
+TEST(Format, MatchesCctz) {
+    const auto dts = random_datetimes(2000);
+
+    for (const auto& pattern : kPatterns) {
+        const Format format(pattern);
+
+        for (const auto& dt : dts) {
+            const auto expected = cctz_format(pattern, dt);
+            const auto formatted = dt.format(format);
+
+            EXPECT_THAT(formatted, expected) << pattern;
+            EXPECT_LE(formatted.size(), format.max_size()) << pattern;
+            EXPECT_THAT(dt.format(pattern), expected) << pattern;
+
+            char buffer[64];
+            const auto size = dt.format_to(buffer, sizeof(buffer), format);
+
+            EXPECT_THAT(std::string(buffer, size), expected) << pattern;
+        }
+    }
+}
+
+TEST(Format, FormatTo) {
+    const auto dt = DateTime(2020, 4, 3, 22, 18, 26, "Asia/Tokyo").add_microseconds(1500);
+
+    char buffer[max_format_size("%Y-%m-%dT%H:%M:%E*S%Ez")];
+    auto size = dt.format_to(buffer, sizeof(buffer));
+
+    EXPECT_THAT(std::string(buffer, size), "2020-04-03T22:18:26.0015+09:00");
+
+    // Values are cut to the buffer, whose size is still reported
+    size = dt.format_to(buffer, 4, Format("%d/%m/%Y"));
+
+    EXPECT_THAT(size, 10U);
+    EXPECT_THAT(std::string(buffer, 4), "03/0");
+
+    size = dt.format_to(buffer, 4, Format("%a %b"));
+
+    EXPECT_THAT(size, 7U);
+    EXPECT_THAT(std::string(buffer, 4), "Fri ");
+
+    std::string out = "at ";
+    dt.format_to(std::back_inserter(out), Format("%H:%M"));
+
+    EXPECT_THAT(out, "at 22:18");
+
+    std::vector<char> chars;
+    Date(2020, 4, 3).format_to(std::back_inserter(chars));
+
+    EXPECT_THAT(std::string(chars.begin(), chars.end()), "2020-04-03");
+
+    size = FixedOffsetDateTime<3600>(dt).format_to(buffer, sizeof(buffer));
+
+    EXPECT_THAT(std::string(buffer, size), "2020-04-03T14:18:26+01:00");
+}
+
+TEST(Format, MaxFormatSize) {
+    static_assert(max_format_size("%Y-%m-%d") == 26, "");
+    static_assert(max_format_size("%Y-%m-%dT%H:%M:%E*S%Ez") == 51, "");
+    static_assert(max_format_size("%E3S %E*f %E0f %%") == 19, "");
+    static_assert(max_format_size("%a") == internal::kUnboundedSize, "");
+    static_assert(max_format_size("%Y %") == internal::kUnboundedSize, "");
+
+    for (const auto& pattern : kPatterns) {
+        EXPECT_THAT(max_format_size(pattern.c_str()), Format(pattern).max_size()) << pattern;
+    }
+}
+
+TEST(Format, Stream) {
+    const auto dt = DateTime(2020, 4, 3, 22, 18, 26, "Asia/Tokyo");
+
+    std::ostringstream out;
+    out << dt << " " << dt.date() << " " << FixedOffsetDateTime<0>(dt);
+
+    EXPECT_THAT(out.str(), "2020-04-03T22:18:26+09:00 2020-04-03 2020-04-03T13:18:26+00:00");
+
+    // Padding still applies
+    out.str("");
+    out << std::setw(12) << std::left << dt.date() << "|";
+
+    EXPECT_THAT(out.str(), "2020-04-03  |");
+}
+
+TEST(Format, FormatToCached) {
+    // Consecutive values cross seconds, minutes, a day and the start of DST, with fractions of
+    // every length, alternating between as many patterns as the thread keeps
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> seconds(0, 2);
+    std::uniform_int_distribution<int> nanos(0, 999999999);
+    std::uniform_int_distribution<int> digits(0, 9);
+
+    auto base = DateTime(2020, 3, 28, 23, 58, 0, "Europe/Amsterdam");
+    std::vector<DateTime> dts;
+
+    for (int i = 0; i < 20000; ++i) {
+        const auto scale = internal::kPowersOf10[digits(engine)];
+
+        base = base.add_seconds(seconds(engine));
+        dts.push_back(base.add_microseconds(nanos(engine) / scale * scale / 1000));
+    }
+
+    const std::vector<Format> formats = {Format(kPatterns[6]), Format("[%F %T%E*f %z]"),
+                                         Format(kPatterns[4])};
+
+    for (std::size_t i = 0; i < dts.size(); ++i) {
+        for (const auto& format : formats) {
+            char buffer[64];
+            const auto size = dts[i].format_to_cached(buffer, sizeof(buffer), format);
+
+            EXPECT_THAT(std::string(buffer, size), dts[i].format(format)) << i;
+        }
+
+        char buffer[64];
+        const auto size = dts[i].format_to_cached(buffer, sizeof(buffer));
+
+        EXPECT_THAT(std::string(buffer, size), dts[i].to_iso8601_string());
+    }
+
+    EXPECT_THAT(dts.back().day(), 29);
+    EXPECT_THAT(dts.back().offset(), 7200);
+
+    // Formats the cache does not keep, and short buffers
+    const auto dt = DateTime(2020, 4, 3, 22, 18, 26, "Asia/Tokyo");
+    char buffer[8];
+
+    EXPECT_THAT(dt.format_to_cached(buffer, sizeof(buffer), Format("%a %b")), 7U);
+    EXPECT_THAT(std::string(buffer, 7), "Fri Apr");
+    EXPECT_THAT(dt.format_to_cached(buffer, 4, Format("%d/%m/%Y")), 10U);
+    EXPECT_THAT(std::string(buffer, 4), "03/0");
+}
+
+TEST(Format, Parse) {
+    const Format format("%Y-%m-%d %H:%M:%S");
+
+    EXPECT_THAT(from_format("2020-04-03 22:18:26", format, "Asia/Tokyo"),
+                DateTime(2020, 4, 3, 22, 18, 26, "Asia/Tokyo"));
+    EXPECT_THAT(from_format("2020-4-3 22:18:26", format, "Asia/Tokyo"),
+                DateTime(2020, 4, 3, 22, 18, 26, "Asia/Tokyo"));
+    EXPECT_THAT(from_format("  2020-04-03    22:18:26 ", format),
+                DateTime(2020, 4, 3, 22, 18, 26));
+    EXPECT_THAT(from_format("2020-04-03 22:18:60", format), DateTime(2020, 4, 3, 22, 19, 0));
+    EXPECT_THAT(from_format("20200403", Format("%Y%m%d")), DateTime(2020, 4, 3));
+
+    EXPECT_FALSE(try_from_format("2020-02-30 00:00:00", format));
+    EXPECT_FALSE(try_from_format("2020-04-03", format));
+    EXPECT_FALSE(try_from_format("2020-04-03 22:18:26", format, "Mars/Olympus"));
+
+    EXPECT_THAT(try_from_format("2020-04-03T22:18:26.5+09:00", Format("%Y-%m-%dT%H:%M:%E*S%Ez"))
+                        ->timestamp(),
+                DateTime(2020, 4, 3, 13, 18, 26).timestamp());
+
+    // Fractions are kept to the nanosecond
+    EXPECT_THAT(from_format("22:18:26.123456789123", Format("%H:%M:%E*S")).nanosecond(),
+                123456789);
+    EXPECT_THAT(from_format("22:18:26.5", Format("%H:%M:%E3S")).nanosecond(), 500000000);
+}
+
+TEST(Format, ParseRoundTrip) {
+    const auto dts = random_datetimes(2000);
+
+    for (const auto* pattern : {"%Y-%m-%dT%H:%M:%E*S%Ez", "%Y-%m-%d %H:%M:%E9S %z"}) {
+        const Format format(pattern);
+
+        for (const auto& dt : dts) {
+            // %Ez drops the seconds of offsets
+            if (dt.offset() % 60 != 0) {
+                continue;
+            }
+
+            const auto parsed = from_format(dt.format(format), format, dt.timezone_name());
+
+            EXPECT_THAT(parsed, dt) << pattern << " " << dt.format(format);
+            EXPECT_THAT(parsed.nanosecond(), dt.nanosecond()) << pattern;
+        }
+    }
+
+    // Fixed widths keep their digits
+    const auto dt = from_format("2020-04-03 22:18:26.123456", Format("%Y-%m-%d %H:%M:%E6S"));
+
+    EXPECT_THAT(dt.format(Format("%E3S")), "26.123");
+    EXPECT_THAT(dt.nanosecond(), 123456000);
+}
+
+TEST(Format, ParseMatchesCctz) {
+    // Formatted values of every pattern, and single-character changes of them, which parse to the
+    // same instant as through cctz or fail as they do there
+    const std::string alphabet = "0123456789 :-+.TZ";
+    const auto dts = random_datetimes(1000);
+
+    std::mt19937 engine(7);
+    std::uniform_int_distribution<std::size_t> chars(0, alphabet.size() - 1);
+    std::size_t natives = 0;
+
+    for (const auto& pattern : kPatterns) {
+        const Format format(pattern);
+
+        for (const auto& dt : dts) {
+            auto input = dt.format(format);
+
+            for (int i = 0; i < 2; ++i) {
+                const auto zone = dt.timezone_name();
+
+                std::int64_t instant = 0;
+                std::int32_t nanos = 0;
+                cctz::time_point<cctz::seconds> tp;
+                cctz::detail::femtoseconds fs;
+
+                const auto native = format.parses_natively() &&
+                                    internal::parse_format(input, format, internal::zone_id(zone),
+                                                           &instant, &nanos);
+                const auto parsed =
+                        cctz::detail::parse(pattern, input, internal::timezone(zone), &tp, &fs);
+                const auto expected_nanos = static_cast<std::int32_t>(fs.count() / 1000000);
+
+                natives += native ? 1 : 0;
+
+                EXPECT_TRUE(!native || parsed) << pattern << " " << input;
+                EXPECT_TRUE(!native || instant == tp.time_since_epoch().count())
+                        << pattern << " " << input;
+                EXPECT_TRUE(!native || nanos == expected_nanos) << pattern << " " << input;
+
+                const auto result = try_from_format(input, format, zone);
+
+                EXPECT_THAT(static_cast<bool>(result), parsed) << pattern << " " << input;
+                EXPECT_TRUE(!result || result->timestamp() == tp.time_since_epoch().count())
+                        << pattern << " " << input;
+                EXPECT_TRUE(!result || result->nanosecond() == expected_nanos)
+                        << pattern << " " << input;
+
+                if (input.empty()) {
+                    break;
+                }
+
+                input[std::uniform_int_distribution<std::size_t>(0, input.size() - 1)(engine)] =
+                        alphabet[chars(engine)];
+            }
+        }
+    }
+
+    EXPECT_GT(natives, dts.size() * 4);
+}
+
+TEST(Format, Macro) {
+    const Format* first = nullptr;
+
+    for (int i = 0; i < 2; ++i) {
+        const auto& format = PENDULUM_FORMAT("%Y-%m-%d");
+
+        EXPECT_THAT(format.pattern(), "%Y-%m-%d");
+        EXPECT_TRUE(first == nullptr || first == &format);
+
+        first = &format;
+    }
+}
+
+}  // namespace pendulum
@@ -0,0 +1,68 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Built with -fno-exceptions to check that the library compiles without exception support,
+// and that the try_ functions report errors without aborting.
+
+#include <cstdio>
+
+#include "pendulum/pendulum.h"
+
+#ifndef PENDULUM_NO_EXCEPTIONS
+#error "PENDULUM_NO_EXCEPTIONS must be detected when exceptions are disabled"
+#endif
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::fprintf(stderr, "FAILED: %s\n", what);
+        ++failures;
+    }
+}
+
+}  // namespace
+
+int main() {
+    using namespace pendulum;
+
+    check(try_datetime(2020, 4, 3, 15, 30, 10, "Asia/Tokyo").has_value(), "try_datetime");
+    check(try_datetime(2020, 2, 30).error().code() == kInvalidDateTime, "invalid datetime");
+    check(try_datetime(2020, 4, 3, 0, 0, 0, "invalid").error().code() == kInvalidTimezone,
+          "invalid timezone");
+    check(try_date(2020, 13, 1).error().code() == kInvalidDateTime, "invalid date");
+    check(DateTime(2020, 4, 3).try_start_of("century").error().code() == kInvalidUnit,
+          "invalid unit");
+    check(period(DateTime(2020, 1, 1), DateTime(2020, 1, 3)).try_range("days").has_value(),
+          "range");
+    check(try_parse("2006-01-02T15:04:05Z").value_or(DateTime()) == DateTime(2006, 1, 2, 15, 4, 5),
+          "try_parse");
+    check(try_parse("2006/01/02").error().code() == kUnsupportedFormat, "unsupported format");
+    check(try_from_format("2006-01-02", "%Y%m%d").error().message() ==
+                  "input: 2006-01-02 - format: %Y%m%d",
+          "error message");
+    check(parse("2006-01-02") == DateTime(2006, 1, 2), "parse");
+
+    return failures == 0 ? 0 : 1;
+}
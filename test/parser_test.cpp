@@ -22,6 +22,12 @@
 
 #include <gmock/gmock.h>
 
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <cctz/time_zone.h>
+
 #include "pendulum/exceptions.h"
 #include "pendulum/parser.h"
 
@@ -92,6 +98,100 @@ TEST(Parser, Iso8601DateFormat4) {
     EXPECT_THAT(dt, DateTime(2006, 1, 1));
 }
 
+TEST(Parser, FractionalSeconds) {
+    EXPECT_THAT(parse("2006-01-02T15:04:05.123Z").nanosecond(), 123000000);
+    EXPECT_THAT(parse("2006-01-02T15:04:05,5Z").nanosecond(), 500000000);
+    EXPECT_THAT(parse("2006-01-02 15:04:05.123456789").nanosecond(), 123456789);
+    EXPECT_THAT(parse("20060102T150405.0000000019Z").nanosecond(), 1);
+
+    const auto& dt = parse("2006-01-02T15:04:05.25-07:00", "MST");
+
+    EXPECT_THAT(dt, DateTime(2006, 1, 2, 15, 4, 5, "MST").add_nanoseconds(250000000));
+    EXPECT_THAT(dt.to_iso8601_string(), "2006-01-02T15:04:05.25-07:00");
+}
+
+TEST(Parser, Offsets) {
+    const auto& dt = DateTime(2006, 1, 2, 6, 4, 5);
+
+    EXPECT_THAT(parse("2006-01-02T15:04:05+09:00"), dt);
+    EXPECT_THAT(parse("2006-01-02T15:04:05+0900"), dt);
+    EXPECT_THAT(parse("2006-01-02T15:04:05+09"), dt);
+    EXPECT_THAT(parse("2006-01-02 15:04:05+09:00"), dt);
+    EXPECT_THAT(parse("20060102T150405+09:00"), dt);
+    EXPECT_THAT(parse("2006-01-02t06:04:05z"), dt);
+    EXPECT_THAT(parse("2006-01-02T14:34:05+08:30"), dt);
+
+    // The result keeps the requested timezone
+    EXPECT_THAT(parse("2006-01-02T15:04:05+09:00", "America/New_York").timezone_name(),
+                "America/New_York");
+    EXPECT_THAT(parse("2006-01-02T15:04:05+09:00", "America/New_York").hour(), 1);
+}
+
+TEST(Parser, LocalTime) {
+    // Without an offset the time is local to the timezone, like the other formats
+    EXPECT_THAT(parse("2006-01-02T15:04:05", "Asia/Tokyo"),
+                DateTime(2006, 1, 2, 15, 4, 5, "Asia/Tokyo"));
+    EXPECT_THAT(parse("20060102T150405", "Asia/Tokyo"),
+                DateTime(2006, 1, 2, 15, 4, 5, "Asia/Tokyo"));
+
+    // Skipped and repeated times resolve with the offset before the transition
+    EXPECT_THAT(parse("2020-03-08 02:30:00", "America/New_York"),
+                DateTime(2020, 3, 8, 3, 30, 0, "America/New_York"));
+    EXPECT_THAT(parse("2020-11-01 01:30:00", "America/New_York"),
+                DateTime(2020, 11, 1, 1, 30, 0, "America/New_York"));
+}
+
+TEST(Parser, Lenient) {
+    EXPECT_THAT(parse("  2006-01-02T15:04:05Z\n"), DateTime(2006, 1, 2, 15, 4, 5));
+    EXPECT_THAT(parse("2006-1-2 3:4:5"), DateTime(2006, 1, 2, 3, 4, 5));
+    EXPECT_THAT(parse("-001-01-01"), DateTime(-1, 1, 1));
+    EXPECT_THAT(parse("0000"), DateTime(0, 1, 1));
+
+    // A leap second moves forward to the next second
+    EXPECT_THAT(parse("2016-12-31T23:59:60.5Z"), DateTime(2017, 1, 1));
+}
+
+TEST(Parser, MatchesCctz) {
+    const std::string formats[] = {
+            "%E4Y-%m-%dT%H:%M:%S%Ez", "%E4Y-%m-%dT%H:%M:%SZ", "%E4Y%m%dT%H%M%S%z",
+            "%E4Y-%m-%d %H:%M:%S",    "%E4Y-%m-%d",           "%E4Y-%m",
+            "%E4Y%m%d",               "%E4Y",
+    };
+    const std::string inputs[] = {
+            "2020-02-29T23:59:59+05:45", "2020-02-30T00:00:00Z", "2021-02-29",
+            "1999-12-31 23:59:60",       "20200101T000000-0330", "2020-3-8 2:30:00",
+            "2020-11-01 01:30:00",       "0001-01-01",           "-999-12",
+            "9999-12-31T23:59:59-23:59", "1970",                 "19700101",
+            "2020115",                   "2020-01-01T24:00:00Z", "2020-01-01T00:00:00+24:00",
+            "2020-00-01",                "2020-01-00",           "202",
+            "-000-01-01",                "2020-01-01T00:00:00+0",
+    };
+
+    for (const auto& tz : {"UTC", "America/New_York", "Australia/Lord_Howe"}) {
+        for (const auto& input : inputs) {
+            internal::optional<DateTime> expected;
+
+            for (const auto& fmt : formats) {
+                cctz::time_point<std::chrono::seconds> tp;
+
+                if (cctz::parse(fmt, input, internal::timezone(tz), &tp)) {
+                    expected = DateTime::from_instant(tp.time_since_epoch().count(),
+                                                      internal::zone_id(tz));
+                    break;
+                }
+            }
+
+            const auto dt = try_parse(input, tz);
+
+            EXPECT_THAT(dt.has_value(), expected.has_value()) << input;
+
+            if (expected && dt) {
+                EXPECT_THAT(*dt, *expected) << input << " " << tz;
+            }
+        }
+    }
+}
+
 TEST(Parser, Iso8601DateFormatWithFormat) {
     const auto& dt = from_format("100001231", "%Y%m%d");
 
@@ -143,4 +243,129 @@ TEST(Parser, InvalidDateTimeWithFormat) {
     EXPECT_THROW(from_format("not-a-date", "%Y-%m-%d"), PendulumException);
 }
 
+TEST(Parser, TryParse) {
+    EXPECT_THAT(*try_parse("2006-01-02T15:04:05Z"), DateTime(2006, 1, 2, 15, 4, 5));
+    EXPECT_THAT(*try_parse("20060102", "Asia/Tokyo"), DateTime(2006, 1, 2, "Asia/Tokyo"));
+
+    const std::string input = "2006/01/02";
+    const auto dt = try_parse(input);
+
+    EXPECT_FALSE(dt);
+    EXPECT_THAT(dt.error().code(), kUnsupportedFormat);
+    EXPECT_THAT(dt.error().message(), "input: 2006/01/02");
+    EXPECT_THROW(dt.value(), UnsupportedFormat);
+
+    EXPECT_THAT(try_parse("2023-02-30").error().code(), kUnsupportedFormat);
+    EXPECT_THAT(try_parse("2006", "invalid").error().code(), kInvalidTimezone);
+}
+
+TEST(Parser, TryFromFormat) {
+    EXPECT_THAT(*try_from_format("02/01/2006", "%d/%m/%Y"), DateTime(2006, 1, 2));
+    EXPECT_THAT(*try_from_format("100001231", "%Y%m%d"), DateTime(10000, 12, 31));
+
+    const std::string input = "2006-01-02";
+    const std::string fmt = "%d/%m/%Y";
+
+    EXPECT_THAT(try_from_format(input, fmt).error().message(),
+                "input: 2006-01-02 - format: %d/%m/%Y");
+    EXPECT_THAT(try_from_format(input, "%Y%m%d").error().message(),
+                "input: 2006-01-02 - format: %Y%m%d");
+    EXPECT_THAT(try_from_format("20230230", "%Y%m%d").error().code(), kUnsupportedFormat);
+    EXPECT_THAT(try_from_format("99999999999991231", "%Y%m%d").error().code(),
+                kUnsupportedFormat);
+}
+
+TEST(Parser, Slices) {
+    // Fields of a record, none of them null-terminated
+    const char record[] = "2006-01-02T15:04:05Z|20060102|02/01/2006|Asia/Tokyo|UTC";
+    const internal::string_view buffer(record, sizeof(record) - 1);
+    const auto tz = buffer.substr(41, 10);
+
+    EXPECT_THAT(parse(buffer.substr(0, 20)), DateTime(2006, 1, 2, 15, 4, 5));
+    EXPECT_THAT(parse(record, 10, tz), DateTime(2006, 1, 2, "Asia/Tokyo"));
+    EXPECT_THAT(parse(buffer.substr(21, 8), tz), DateTime(2006, 1, 2, "Asia/Tokyo"));
+    EXPECT_THAT(from_format(buffer.substr(21, 8), "%Y%m%d", tz),
+                DateTime(2006, 1, 2, "Asia/Tokyo"));
+    EXPECT_THAT(from_format(record + 30, 10, "%d/%m/%Y"), DateTime(2006, 1, 2));
+    EXPECT_THAT(from_format(buffer.substr(30, 10), "%d/%m/%Y", buffer.substr(52)),
+                DateTime(2006, 1, 2));
+
+    EXPECT_FALSE(try_parse(record, 11));
+    EXPECT_THAT(try_parse(record, 11).error().message(), "input: 2006-01-02T");
+    EXPECT_FALSE(try_from_format(buffer.substr(21, 7), "%Y%m%d"));
+    EXPECT_FALSE(try_from_format(buffer.substr(30, 5), "%d/%m/%Y"));
+    EXPECT_THAT(try_parse(buffer.substr(0, 20), buffer.substr(41, 5)).error().code(),
+                kInvalidTimezone);
+}
+
+TEST(Parser, ParseMany) {
+    // Rows of one layout, interleaved with other layouts and with values the layout rejects
+    const std::vector<internal::string_view> rows = {
+            "2020-01-01T00:00:00Z",      "2020-01-01T00:00:01Z",      "2020-02-30T00:00:00Z",
+            "2020-02-29T23:59:60Z",      "2020-01-01T24:00:00Z",      "2020-01-01T00:00:00+09:00",
+            "2020-01-01T00:00:00-09:00", "2020-01-01T00:00:00-24:00", "2020-01-01T00:00:00.5Z",
+            "2020-01-01T00:00:00.25Z",   "-001-01-01",                "-000-01-01",
+            "0000-01-01",                "2020-3-8 2:30:00",          "2020-3-8 2:30:60",
+            "20200308T023000",           "not a date",                "",
+            " 2020-01-01 ",              "2020-11-01 01:30:00",       "2020",
+            "2020-13",                   "2020-12",
+    };
+
+    std::vector<DateTime> dts;
+    ValidityBitmap valid;
+    std::size_t expected = 0;
+
+    const auto n = parse_many(rows, &dts, &valid, "America/New_York");
+
+    ASSERT_THAT(dts.size(), rows.size());
+    ASSERT_THAT(valid.size(), rows.size());
+
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const auto dt = try_parse(std::string(rows[i].data(), rows[i].size()), "America/New_York");
+
+        EXPECT_THAT(valid[i], dt.has_value()) << rows[i];
+        EXPECT_THAT(dts[i], dt.value_or(DateTime::epoch())) << rows[i];
+        EXPECT_THAT(dts[i].timezone_name(), "America/New_York");
+
+        expected += dt ? 1 : 0;
+    }
+
+    EXPECT_THAT(n, expected);
+    EXPECT_THAT(valid.count(), expected);
+}
+
+TEST(Parser, ParseManyTimePoints) {
+    using TimePoint = std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
+
+    // Time points in nanoseconds only cover the years 1678 to 2261
+    const std::vector<internal::string_view> rows = {"2020-01-01T00:00:00.5+01:00", "2000-01-01",
+                                                     "1000-01-01", "3000-01-01"};
+    std::vector<TimePoint> tps;
+    ValidityBitmap valid;
+
+    EXPECT_THAT(parse_many(rows, &tps, &valid), 2);
+    EXPECT_THAT(tps[0], DateTime(2019, 12, 31, 23, 0, 0).add_nanoseconds(500000000)
+                                .time_point<std::chrono::nanoseconds>());
+    EXPECT_THAT(tps[1], DateTime(2000, 1, 1).time_point<std::chrono::nanoseconds>());
+    EXPECT_THAT(tps[2], TimePoint());
+    EXPECT_THAT(valid.words(), testing::ElementsAre(3));
+}
+
+TEST(Parser, ParseManyBuffer) {
+    std::vector<DateTime> dts;
+    ValidityBitmap valid;
+
+    EXPECT_THAT(parse_many("2020-01-01\n2020-01-02\nbad\n\n2020-01-05\n", '\n', &dts, &valid,
+                           "Asia/Tokyo"),
+                3);
+    EXPECT_THAT(dts, testing::ElementsAre(DateTime(2020, 1, 1, "Asia/Tokyo"),
+                                          DateTime(2020, 1, 2, "Asia/Tokyo"), DateTime::epoch(),
+                                          DateTime::epoch(), DateTime(2020, 1, 5, "Asia/Tokyo")));
+    EXPECT_THAT(valid.words(), testing::ElementsAre(0x13));
+
+    EXPECT_THAT(parse_many("", '\n', &dts, &valid), 0);
+    EXPECT_THAT(dts, testing::IsEmpty());
+    EXPECT_THAT(valid.size(), 0);
+}
+
 }  // namespace pendulum
@@ -232,6 +232,13 @@ TEST(Period, UnorderedMap) {
     };
 
     EXPECT_THAT(map[Period()], 1);
+
+    const Period period(DateTime(2020, 1, 1), DateTime(2020, 2, 1));
+    map[period] = 2;
+
+    EXPECT_THAT(map[Period(DateTime(2020, 1, 1).in_timezone("Asia/Tokyo"), DateTime(2020, 2, 1))],
+                2);
+    EXPECT_THAT(map.count(Period(DateTime(2020, 1, 1), DateTime(2020, 2, 1), true)), 0u);
 }
 
 TEST(Period, Contains) {
@@ -250,11 +257,60 @@ TEST(Period, Contains) {
     EXPECT_FALSE(inverted_period.contains(DateTime(2022, 1, 15)));
 }
 
+TEST(Period, SubSecond) {
+    const auto start = DateTime(2022, 1, 10).add_microseconds(500000);
+    const auto stop = DateTime(2022, 1, 10, 0, 0, 2).add_microseconds(250000);
+    const auto period = Period(start, stop);
+
+    EXPECT_THAT(period.in_seconds(), 1);
+    EXPECT_THAT(Period(stop, start).in_seconds(), -1);
+    EXPECT_TRUE(period.contains(stop));
+    EXPECT_FALSE(period.contains(stop.add_nanoseconds(1)));
+    EXPECT_FALSE(period.contains(DateTime(2022, 1, 10)));
+}
+
 TEST(Period, RangeInvalidUnit) {
     auto period = Period(DateTime(2022, 1, 1), DateTime(2022, 1, 2));
     EXPECT_THROW(period.range("invalid_unit"), InvalidUnit);
 }
 
+TEST(Period, TryRange) {
+    Period period(DateTime(2020, 1, 1), DateTime(2020, 1, 3));
+
+    const auto days = period.try_range("days");
+
+    EXPECT_TRUE(days);
+    EXPECT_THAT(std::distance(days->begin(), days->end()), 3);
+
+    const auto invalid = period.try_range("invalid_unit");
+
+    EXPECT_FALSE(invalid);
+    EXPECT_THAT(invalid.error().code(), kInvalidUnit);
+    EXPECT_THAT(invalid.error().message(), "unit for range(): invalid_unit");
+}
+
+TEST(Period, RangeUnit) {
+    Period period(DateTime(2020, 1, 1), DateTime(2020, 1, 1, 5));
+
+    const auto by_name = period.range("hours", 2);
+    const auto by_unit = period.range(Unit::kHour, 2);
+    const auto by_template = period.range<Unit::kHour>(2);
+
+    const std::vector<DateTime> hours(by_name.begin(), by_name.end());
+
+    EXPECT_THAT(hours, testing::ElementsAre(DateTime(2020, 1, 1, 0), DateTime(2020, 1, 1, 2),
+                                            DateTime(2020, 1, 1, 4)));
+    EXPECT_THAT(std::vector<DateTime>(by_unit.begin(), by_unit.end()), hours);
+    EXPECT_THAT(std::vector<DateTime>(by_template.begin(), by_template.end()), hours);
+
+    const auto weeks = Period(DateTime(2020, 1, 29), DateTime(2020, 1, 1)).range<Unit::kWeek>();
+
+    EXPECT_THAT(std::vector<DateTime>(weeks.begin(), weeks.end()),
+                testing::ElementsAre(DateTime(2020, 1, 29), DateTime(2020, 1, 22),
+                                     DateTime(2020, 1, 15), DateTime(2020, 1, 8),
+                                     DateTime(2020, 1, 1)));
+}
+
 TEST(Period, InvertedPeriodCalculations) {
     auto start = DateTime(2022, 1, 20);
     auto stop = DateTime(2022, 1, 10);
@@ -0,0 +1,106 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include <cctz/time_zone.h>
+
+#include "pendulum/preload.h"
+
+namespace pendulum {
+
+TEST(Preload, Timezones) {
+    const std::vector<std::string> names = {
+            "America/Sao_Paulo", "Europe/Berlin", "Nowhere/Nothing", "Asia/Kolkata", "UTC",
+    };
+
+    const auto report = preload_timezones(names, 3);
+
+    ASSERT_THAT(report.zones.size(), names.size());
+    EXPECT_THAT(report.loaded(), 4u);
+    EXPECT_THAT(report.memory_usage(), testing::Gt(0u));
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        const auto& zone = report.zones[i];
+
+        EXPECT_THAT(zone.name, names[i]);
+        EXPECT_THAT(zone.loaded, names[i] != "Nowhere/Nothing");
+        EXPECT_THAT(zone.duration, testing::Le(report.duration));
+
+        if (zone.loaded) {
+            EXPECT_TRUE(internal::ZoneRegistry::instance().find(names[i]).has_value());
+            EXPECT_THAT(zone.memory_usage, testing::Gt(0u));
+        } else {
+            EXPECT_THAT(zone.memory_usage, 0u);
+        }
+    }
+}
+
+TEST(Preload, Empty) {
+    const auto report = preload_timezones({});
+
+    EXPECT_TRUE(report.zones.empty());
+    EXPECT_THAT(report.loaded(), 0u);
+}
+
+TEST(Preload, TimezonesIn) {
+    const std::string config =
+            "server:\n"
+            "  timezone: America/Sao_Paulo  # not Etc/Nowhere\n"
+            "  reports: [\"Europe/Berlin\", \"Etc/GMT+5\", \"America/Sao_Paulo\"]\n"
+            "  log_zone=UTC; path=/var/log/app\n";
+
+    EXPECT_THAT(timezones_in(config),
+                testing::ElementsAre("America/Sao_Paulo", "Europe/Berlin", "Etc/GMT+5", "UTC"));
+    EXPECT_TRUE(timezones_in("").empty());
+
+    const auto report = preload_timezones_in(config, 2);
+
+    EXPECT_THAT(report.zones.size(), 4u);
+    EXPECT_THAT(report.loaded(), 4u);
+}
+
+TEST(Preload, MemoryUsage) {
+    // cctz keeps the transitions of the zone too
+    const auto& zone = internal::zone(internal::zone_id("America/New_York"));
+
+    EXPECT_THAT(preload_timezones({"America/New_York"}).memory_usage(),
+                testing::Gt(zone.table.memory_usage() +
+                            zone.table.instants().size() * sizeof(cctz::civil_second)));
+}
+
+TEST(Preload, AllTimezones) {
+    const auto names = available_timezones();
+
+    ASSERT_THAT(names, testing::Contains("Asia/Tokyo"));
+    EXPECT_TRUE(std::is_sorted(names.begin(), names.end()));
+
+    const auto report = preload_all_timezones();
+
+    EXPECT_THAT(report.zones.size(), names.size());
+    EXPECT_THAT(report.loaded(), names.size());
+}
+
+}  // namespace pendulum
@@ -0,0 +1,212 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cctz/time_zone.h>
+
+#include "pendulum/parser.h"
+#include "pendulum/simd.h"
+
+namespace pendulum {
+
+namespace {
+
+struct Decoded {
+    bool ok;
+    std::int64_t instant;
+    std::int32_t nanos;
+
+    bool operator==(const Decoded& other) const {
+        return ok == other.ok && (!ok || (instant == other.instant && nanos == other.nanos));
+    }
+};
+
+std::vector<internal::SimdLevel> supported_levels() {
+    std::vector<internal::SimdLevel> levels = {internal::SimdLevel::kScalar};
+
+    if (internal::simd_level() != internal::SimdLevel::kScalar) {
+        levels.push_back(internal::SimdLevel::kSse41);
+    }
+
+    if (internal::simd_level() == internal::SimdLevel::kAvx2) {
+        levels.push_back(internal::SimdLevel::kAvx2);
+    }
+
+    return levels;
+}
+
+Decoded decode(const std::string& input, internal::SimdLevel level) {
+    Decoded decoded{false, 0, 0};
+    decoded.ok = internal::decode_utc_timestamp(input, level, &decoded.instant, &decoded.nanos);
+    return decoded;
+}
+
+// cctz reads the same layout, with more leeway: whitespace around it, wider years, second 60
+Decoded cctz_decode(const std::string& input) {
+    cctz::time_point<cctz::seconds> tp;
+    cctz::detail::femtoseconds fs;
+    Decoded decoded{false, 0, 0};
+
+    if (cctz::detail::parse("%Y-%m-%dT%H:%M:%E*SZ", input, cctz::utc_time_zone(), &tp, &fs)) {
+        decoded = Decoded{true, tp.time_since_epoch().count(),
+                          static_cast<std::int32_t>(fs.count() / 1000000)};
+    }
+
+    return decoded;
+}
+
+// What a decoder takes, cctz takes with the same value
+void expect_within_cctz(const std::string& input) {
+    const auto expected = cctz_decode(input);
+
+    for (const auto level : supported_levels()) {
+        const auto decoded = decode(input, level);
+
+        if (decoded.ok) {
+            EXPECT_THAT(decoded, expected) << input;
+        }
+    }
+}
+
+std::string random_timestamp(std::mt19937* engine) {
+    std::uniform_int_distribution<std::int64_t> instants(-62167219200, 253402300799);
+    std::uniform_int_distribution<int> digits(0, 9);
+    std::uniform_int_distribution<int> nanos(0, 999999999);
+
+    const auto dt = DateTime::from_instant(instants(*engine), internal::zone_id("UTC"));
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02d", dt.year(), dt.month(),
+                  dt.day(), dt.hour(), dt.minute(), dt.second());
+
+    std::string s = buffer;
+    const auto n = digits(*engine);
+
+    if (n > 0) {
+        s += "." + std::to_string(1000000000 + nanos(*engine)).substr(1, n);
+    }
+
+    return s + "Z";
+}
+
+}  // namespace
+
+TEST(Simd, Decode) {
+    for (const auto level : supported_levels()) {
+        EXPECT_THAT(decode("2006-01-02T15:04:05Z", level), (Decoded{true, 1136214245, 0}));
+        EXPECT_THAT(decode("2006-01-02T15:04:05.1Z", level),
+                    (Decoded{true, 1136214245, 100000000}));
+        EXPECT_THAT(decode("2006-01-02T15:04:05.123456789Z", level),
+                    (Decoded{true, 1136214245, 123456789}));
+        EXPECT_THAT(decode("0000-01-01T00:00:00Z", level), (Decoded{true, -62167219200, 0}));
+        EXPECT_THAT(decode("9999-12-31T23:59:59.999999999Z", level),
+                    (Decoded{true, 253402300799, 999999999}));
+        EXPECT_THAT(decode("2020-02-29T00:00:00Z", level).ok, true);
+
+        for (const auto* invalid :
+             {"2021-02-29T00:00:00Z", "2020-13-01T00:00:00Z", "2020-00-01T00:00:00Z",
+              "2020-01-00T00:00:00Z", "2020-01-01T24:00:00Z", "2020-01-01T00:60:00Z",
+              "2020-01-01T00:00:60Z", "2020-01-01t00:00:00Z", "2020-01-01T00:00:00z",
+              "2020-01-01T00:00:00.Z", "2020-01-01T00:00:00,5Z", "2020-01-01T00:00:00.1234567890Z",
+              "2020-01-01T00:00:00+00:00", "2020-01-01 00:00:00Z", "2020-1-01T00:00:00Z",
+              "2020-01-01T00:00:0aZ", "2020-01-01T00:00:00"}) {
+            EXPECT_FALSE(decode(invalid, level).ok) << invalid;
+        }
+    }
+}
+
+TEST(Simd, MatchesCctz) {
+    std::mt19937 engine(42);
+
+    for (int i = 0; i < 20000; ++i) {
+        const auto input = random_timestamp(&engine);
+        const auto expected = cctz_decode(input);
+
+        ASSERT_TRUE(expected.ok) << input;
+
+        for (const auto level : supported_levels()) {
+            EXPECT_THAT(decode(input, level), expected) << input;
+        }
+    }
+
+    // Rejected by cctz, or left to the scanner
+    for (const auto* input :
+         {" 2020-01-01T00:00:00Z", "2020-01-01T00:00:00Z ", "+2020-01-01T00:00:00Z",
+          "-2020-01-01T00:00:00Z", "12020-01-01T00:00:00Z", "02020-01-01T00:00:00Z",
+          "2020-1-01T00:00:00Z", "2020-01-01t00:00:00Z", "2020-01-01T00:00:00.Z",
+          "2020-01-01T00:00:60Z", "2020-01-01T00:00:00.1234567890Z", "2021-02-29T00:00:00Z"}) {
+        expect_within_cctz(input);
+
+        for (const auto level : supported_levels()) {
+            EXPECT_FALSE(decode(input, level).ok) << input;
+        }
+    }
+
+    EXPECT_FALSE(cctz_decode("+2020-01-01T00:00:00Z").ok);
+    EXPECT_FALSE(cctz_decode("2020-01-01T00:00:00.Z").ok);
+}
+
+TEST(Simd, MatchesScalar) {
+    // Single-character changes of valid timestamps, which every decoder must treat alike and
+    // which cctz and the scanner must agree with when they decode
+    const std::string alphabet = "0123456789:-.TtZz +/\xff";
+    std::mt19937 engine(7);
+    std::uniform_int_distribution<std::size_t> chars(0, alphabet.size() - 1);
+
+    for (int i = 0; i < 20000; ++i) {
+        auto input = random_timestamp(&engine);
+        input[std::uniform_int_distribution<std::size_t>(0, input.size() - 1)(engine)] =
+                alphabet[chars(engine)];
+
+        const auto expected = decode(input, internal::SimdLevel::kScalar);
+
+        for (const auto level : supported_levels()) {
+            EXPECT_THAT(decode(input, level), expected) << input;
+        }
+
+        expect_within_cctz(input);
+
+        if (expected.ok) {
+            const auto dt = try_parse(input);
+
+            ASSERT_TRUE(dt) << input;
+            EXPECT_THAT(dt->timestamp(), expected.instant) << input;
+            EXPECT_THAT(dt->nanosecond(), expected.nanos) << input;
+        }
+    }
+}
+
+TEST(Simd, Parse) {
+    // The scanner still takes what the decoder leaves
+    EXPECT_THAT(parse("2016-12-31T23:59:60Z"), DateTime(2017, 1, 1));
+    EXPECT_THAT(parse("2006-01-02t15:04:05.5z", "Asia/Tokyo"),
+                DateTime(2006, 1, 3, 0, 4, 5, "Asia/Tokyo").add_nanoseconds(500000000));
+    EXPECT_THAT(parse("2006-01-02T15:04:05.5Z", "Asia/Tokyo").timezone_name(), "Asia/Tokyo");
+}
+
+}  // namespace pendulum
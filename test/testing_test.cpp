@@ -22,6 +22,9 @@
 
 #include <gmock/gmock.h>
 
+#include <chrono>
+#include <thread>
+
 #include "pendulum/pendulum.h"
 #include "pendulum/testing.h"
 
@@ -78,4 +81,28 @@ TEST(Testing, Exception) {
     EXPECT_THAT(now(), Not(test_now));
 }
 
+TEST(Testing, Thread) {
+    const auto& test_now = datetime(2000, 12, 25, 16, 30, 50);
+
+    test(test_now, [&]() {
+        DateTime other;
+
+        std::thread([&other] { other = now(); }).join();
+
+        EXPECT_THAT(now(), test_now);
+        EXPECT_THAT(other, Not(test_now));
+    });
+}
+
+TEST(Testing, Clock) {
+    TickClock clock(datetime(2010, 1, 1), std::chrono::nanoseconds(0));
+    ScopedClock scoped(clock);
+
+    set_test_now(datetime(2000, 1, 1));
+    EXPECT_THAT(now(), datetime(2000, 1, 1));
+
+    set_test_now();
+    EXPECT_THAT(now(), datetime(2010, 1, 1));
+}
+
 }  // namespace pendulum
@@ -0,0 +1,267 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <unistd.h>
+#include <utime.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pendulum/exceptions.h"
+#include "pendulum/helpers.h"
+#include "pendulum/timezone.h"
+
+namespace pendulum {
+
+TEST(Timezone, Utc) {
+    EXPECT_THAT(internal::zone_id("UTC"), internal::kUtcZoneId);
+    EXPECT_THAT(internal::timezone("UTC"), cctz::utc_time_zone());
+}
+
+TEST(Timezone, Intern) {
+    const auto id = internal::zone_id("Asia/Tokyo");
+    const std::string name = "Asia/Tokyo";
+
+    EXPECT_THAT(internal::zone_id(name), id);
+    EXPECT_THAT(internal::zone_id(internal::string_view(name.data(), name.size())), id);
+    EXPECT_THAT(internal::timezone(id).name(), "Asia/Tokyo");
+
+    cctz::time_zone tz;
+    ASSERT_TRUE(cctz::load_time_zone("Asia/Tokyo", &tz));
+    EXPECT_THAT(internal::ZoneRegistry::instance().intern(tz), id);
+}
+
+TEST(Timezone, Find) {
+    auto& registry = internal::ZoneRegistry::instance();
+
+    EXPECT_FALSE(registry.find("Nowhere/Nothing").has_value());
+    EXPECT_FALSE(registry.load("Nowhere/Nothing").has_value());
+
+    const auto id = internal::zone_id("Europe/Paris");
+
+    EXPECT_THAT(*registry.find("Europe/Paris"), id);
+}
+
+TEST(Timezone, FixedOffset) {
+    auto& registry = internal::ZoneRegistry::instance();
+
+    EXPECT_THAT(registry.fixed(0), internal::kUtcZoneId);
+    EXPECT_THAT(internal::timezone(std::chrono::hours(9)),
+                cctz::fixed_time_zone(std::chrono::hours(9)));
+    EXPECT_THAT(internal::timezone(std::chrono::minutes(-570)).name(), "Fixed/UTC-09:30:00");
+    EXPECT_THAT(internal::timezone(std::chrono::hours(14)).name(), "Fixed/UTC+14:00:00");
+
+    // Pooled offsets resolve to the same zones as their names
+    EXPECT_THAT(registry.fixed(19800), internal::zone_id("Fixed/UTC+05:30:00"));
+}
+
+TEST(Timezone, ArbitraryFixedOffset) {
+    auto& registry = internal::ZoneRegistry::instance();
+    const auto id = registry.fixed(-12345);
+
+    EXPECT_THAT(internal::timezone(id), cctz::fixed_time_zone(std::chrono::seconds(-12345)));
+    EXPECT_THAT(*registry.find_fixed(-12345), id);
+    EXPECT_THAT(registry.fixed(-12345), id);
+    EXPECT_THAT(registry.fixed(15 * 3600), internal::zone_id("Fixed/UTC+15:00:00"));
+    EXPECT_THAT(internal::timezone(registry.fixed(100000)), cctz::utc_time_zone());
+}
+
+TEST(Timezone, InvalidTimezone) {
+    EXPECT_THROW(internal::zone_id("invalid"), InvalidTimezone);
+    EXPECT_THROW(internal::timezone("invalid"), InvalidTimezone);
+}
+
+// Sets TZ for the duration of a test and restores it afterwards
+class ScopedTz {
+   public:
+    explicit ScopedTz(const std::string& tz) {
+        const char* current = std::getenv("TZ");
+        has_previous_ = current != nullptr;
+        previous_ = has_previous_ ? current : "";
+        set(tz);
+    }
+
+    ~ScopedTz() {
+        if (has_previous_) {
+            set(previous_);
+        } else {
+            unsetenv("TZ");
+            internal::ZoneRegistry::instance().invalidate_local();
+        }
+    }
+
+    void set(const std::string& tz) {
+        setenv("TZ", tz.c_str(), 1);
+        internal::ZoneRegistry::instance().invalidate_local();
+    }
+
+   private:
+    bool has_previous_;
+    std::string previous_;
+};
+
+TEST(Timezone, LocalNow) {
+    ScopedTz tz("Asia/Tokyo");
+
+    EXPECT_THAT(now().offset(), 9 * 3600);
+
+    tz.set("Asia/Kolkata");
+
+    EXPECT_THAT(now().offset(), 19800);
+    EXPECT_THAT(today().offset(), 19800);
+}
+
+TEST(Timezone, LocalZone) {
+    ScopedTz tz("Asia/Tokyo");
+
+    const auto id = internal::zone_id("local");
+
+    EXPECT_THAT(internal::zone(id).name, "local");
+    EXPECT_THAT(internal::timezone(id), internal::timezone("Asia/Tokyo"));
+
+    // Cached until checked again
+    setenv("TZ", "America/New_York", 1);
+    EXPECT_THAT(internal::zone_id("local"), id);
+
+    tz.set("America/New_York");
+    const auto changed = internal::zone_id("local");
+
+    EXPECT_THAT(changed, testing::Ne(id));
+    EXPECT_THAT(internal::timezone(changed), internal::timezone("America/New_York"));
+    EXPECT_THAT(internal::timezone(id), internal::timezone("Asia/Tokyo"));
+
+    // Nothing changed
+    internal::ZoneRegistry::instance().invalidate_local();
+    EXPECT_THAT(internal::zone_id("local"), changed);
+
+    tz.set(":Nowhere/Nothing");
+    EXPECT_THAT(internal::timezone(internal::zone_id("local")), cctz::utc_time_zone());
+}
+
+TEST(Timezone, LocalZoneFile) {
+    const auto dir = internal::zoneinfo_dir();
+    const std::string link = testing::TempDir() + "pendulum_localtime";
+
+    unlink(link.c_str());
+    ASSERT_THAT(symlink((dir + "/Europe/Paris").c_str(), link.c_str()), 0);
+
+    ScopedTz tz(":" + link);
+
+    EXPECT_THAT(internal::timezone(internal::zone_id("local")), internal::timezone("Europe/Paris"));
+
+    // Swapping the link is noticed at the next check
+    ASSERT_THAT(unlink(link.c_str()), 0);
+    ASSERT_THAT(symlink((dir + "/Asia/Kolkata").c_str(), link.c_str()), 0);
+    internal::ZoneRegistry::instance().invalidate_local();
+
+    EXPECT_THAT(internal::timezone(internal::zone_id("local")), internal::timezone("Asia/Kolkata"));
+
+    unlink(link.c_str());
+}
+
+TEST(Timezone, LocalZoneFileRewritten) {
+    const auto dir = internal::zoneinfo_dir();
+    const std::string file = testing::TempDir() + "pendulum_localtime_file";
+
+    // Overwrites the file in place, keeping its inode
+    const auto copy = [&file](const std::string& from) {
+        std::ifstream in(from, std::ios::binary);
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        out << in.rdbuf();
+    };
+
+    const auto offset = [](internal::ZoneId id) {
+        // 2020-07-01T00:00:00Z
+        return internal::zone(id).table.lookup(1593561600).offset;
+    };
+
+    unlink(file.c_str());
+    copy(dir + "/Europe/Paris");
+
+    ScopedTz tz(":" + file);
+    const auto paris = internal::zone_id("local");
+
+    EXPECT_THAT(offset(paris), 7200);
+
+    // cctz has the first contents cached under the name of the file
+    copy(dir + "/Asia/Kolkata");
+    internal::ZoneRegistry::instance().invalidate_local();
+    const auto kolkata = internal::zone_id("local");
+
+    EXPECT_THAT(kolkata, testing::Ne(paris));
+    EXPECT_THAT(offset(kolkata), 19800);
+
+    // Touching the file, or restoring contents seen before, takes no new id
+    utimbuf times{1000000000, 1000000000};
+    ASSERT_THAT(utime(file.c_str(), &times), 0);
+    internal::ZoneRegistry::instance().invalidate_local();
+
+    EXPECT_THAT(internal::zone_id("local"), kolkata);
+
+    const auto size = internal::ZoneRegistry::instance().size();
+    copy(dir + "/Europe/Paris");
+    internal::ZoneRegistry::instance().invalidate_local();
+
+    EXPECT_THAT(internal::zone_id("local"), paris);
+    EXPECT_THAT(internal::ZoneRegistry::instance().size(), size);
+
+    unlink(file.c_str());
+}
+
+TEST(Timezone, Concurrency) {
+    const char* names[] = {
+            "America/New_York", "America/Sao_Paulo", "Europe/London",    "Europe/Berlin",
+            "Asia/Kolkata",     "Asia/Shanghai",     "Australia/Sydney", "Pacific/Auckland",
+    };
+
+    std::vector<std::vector<internal::ZoneId>> ids(8);
+    std::vector<std::thread> threads;
+
+    for (auto& v : ids) {
+        threads.emplace_back([&names, &v]() {
+            for (const auto* name : names) {
+                v.push_back(internal::zone_id(name));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& v : ids) {
+        EXPECT_THAT(v, ids.front());
+    }
+
+    for (size_t i = 0; i < ids.front().size(); ++i) {
+        EXPECT_THAT(internal::timezone(ids.front()[i]).name(), names[i]);
+    }
+}
+
+}  // namespace pendulum
@@ -0,0 +1,115 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include "pendulum/timezone.h"
+#include "pendulum/transitions.h"
+
+namespace pendulum {
+
+namespace {
+
+const char* const kZones[] = {
+        "UTC",           "Asia/Tokyo",         "America/New_York", "America/Sao_Paulo",
+        "Europe/London", "Europe/Paris",       "Asia/Kolkata",     "Australia/Lord_Howe",
+        "Pacific/Apia",  "America/St_Johns",   "Africa/Casablanca",
+};
+
+void ExpectSameAsCctz(const cctz::time_zone& tz, const internal::TransitionTable& table,
+                      std::int64_t t) {
+    const cctz::time_point<cctz::seconds> tp(cctz::seconds{t});
+    const auto& al = tz.lookup(tp);
+
+    EXPECT_THAT(table.lookup(t).offset, al.offset) << tz.name() << " @ " << t;
+    EXPECT_THAT(table.lookup(t).is_dst != 0, al.is_dst) << tz.name() << " @ " << t;
+    EXPECT_THAT(table.to_local(t), internal::to_seconds(al.cs)) << tz.name() << " @ " << t;
+
+    // Also resolve civil times around the instant, including skipped and repeated ones
+    for (std::int64_t delta = -7200; delta <= 7200; delta += 1800) {
+        const auto& cs = internal::to_civil(t + delta);
+        const auto want = cctz::convert(cs, tz).time_since_epoch().count();
+
+        EXPECT_THAT(table.to_instant(t + delta), want) << tz.name() << " @ " << cs;
+        EXPECT_THAT(table.to_instant_pre(t + delta),
+                    tz.lookup(cs).pre.time_since_epoch().count())
+                << tz.name() << " @ " << cs;
+
+        std::int32_t offset = 0;
+        table.to_instant(t + delta, &offset);
+        EXPECT_THAT(offset, table.lookup(want).offset) << tz.name() << " @ " << cs;
+    }
+}
+
+}  // namespace
+
+TEST(TransitionTable, Utc) {
+    internal::TransitionTable table;
+
+    EXPECT_THAT(table.lookup(0).offset, 0);
+    EXPECT_THAT(table.to_instant(1585942210), 1585942210);
+    EXPECT_TRUE(table.instants().empty());
+}
+
+TEST(TransitionTable, FixedOffset) {
+    internal::TransitionTable table(cctz::fixed_time_zone(std::chrono::hours(9)));
+
+    EXPECT_TRUE(table.instants().empty());
+    EXPECT_THAT(table.lookup(0).offset, 32400);
+    EXPECT_THAT(table.to_local(0), 32400);
+    EXPECT_THAT(table.to_instant(32400), 0);
+}
+
+TEST(TransitionTable, Transitions) {
+    for (const auto* name : kZones) {
+        const auto& tz = internal::timezone(name);
+        const auto& table = internal::zone(internal::zone_id(name)).table;
+
+        for (const auto t : table.instants()) {
+            ExpectSameAsCctz(tz, table, t - 1);
+            ExpectSameAsCctz(tz, table, t);
+        }
+    }
+}
+
+TEST(TransitionTable, Sweep) {
+    // 1800-01-01 to 2300-01-01, stepping by a prime number of seconds
+    const std::int64_t first = -5364662400;
+    const std::int64_t last = 10413792000;
+
+    for (const auto* name : kZones) {
+        const auto& tz = internal::timezone(name);
+        const auto& table = internal::zone(internal::zone_id(name)).table;
+
+        for (auto t = first; t < last; t += 7919 * 3607) {
+            ExpectSameAsCctz(tz, table, t);
+        }
+    }
+}
+
+}  // namespace pendulum
@@ -0,0 +1,84 @@
+// MIT License
+
+// Copyright (c) 2026 IDA Kenichiro
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifdef PENDULUM_EMBEDDED_TZDATA
+
+#include <gmock/gmock.h>
+
+#include <string>
+
+#include "pendulum/timezone.h"
+#include "pendulum/tzdata.h"
+
+namespace pendulum {
+
+TEST(Tzdata, Find) {
+    const auto& tzdata = internal::embedded_tzdata();
+
+    ASSERT_THAT(tzdata.size, testing::Gt(0u));
+
+    const auto* zone = internal::find_embedded_zone(tzdata, tzdata.zones[0].name);
+
+    EXPECT_THAT(zone, tzdata.zones);
+    EXPECT_THAT(internal::find_embedded_zone(tzdata, "Nowhere/Nothing"), nullptr);
+
+    for (std::size_t i = 1; i < tzdata.size; ++i) {
+        EXPECT_THAT(std::string(tzdata.zones[i - 1].name), testing::Lt(tzdata.zones[i].name));
+    }
+}
+
+TEST(Tzdata, Load) {
+    const auto& tzdata = internal::embedded_tzdata();
+
+    // Zones are loaded through the embedded source, not ${TZDIR}
+    for (std::size_t i = 0; i < tzdata.size; ++i) {
+        const auto& zone = tzdata.zones[i];
+
+        // UTC is preregistered without loading
+        if (std::string(zone.name) == "UTC") {
+            continue;
+        }
+
+        const auto& tz = internal::timezone(internal::zone_id(zone.name));
+
+        EXPECT_THAT(tz.name(), zone.name);
+        EXPECT_THAT(tz.version(), tzdata.version);
+    }
+}
+
+TEST(Tzdata, Source) {
+    const auto& tzdata = internal::embedded_tzdata();
+    const auto& zone = tzdata.zones[0];
+    internal::EmbeddedZoneInfoSource source(zone, tzdata.version);
+
+    char magic[4];
+
+    EXPECT_THAT(source.Read(magic, sizeof(magic)), sizeof(magic));
+    EXPECT_THAT(std::string(magic, sizeof(magic)), "TZif");
+    EXPECT_THAT(source.Skip(zone.size - sizeof(magic)), 0);
+    EXPECT_THAT(source.Read(magic, sizeof(magic)), 0u);
+    EXPECT_THAT(source.Skip(1), -1);
+}
+
+}  // namespace pendulum
+
+#endif  // PENDULUM_EMBEDDED_TZDATA